@@ -102,6 +102,9 @@ typedef int (*ComparisonFunctionType)(const void*, const void*);
 
 #define UNUSED(x) (void)(x)
 
+/* Storage class for per-thread global variables */
+#define THREAD_LOCAL __thread
+
 #define KILO 1024
 #define MEGA (1024*1024)
 
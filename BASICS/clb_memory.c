@@ -16,6 +16,12 @@
   Changes
 
   Created: Thu Aug 14 10:00:35 MET DST 1997
+  Mon Oct 19 19:40:02 CEST 2026
+    Accounting per allocation class, free list retention
+  Mon Oct 19 20:31:45 CEST 2026
+    Bounded retention, MemTrim()
+  Mon Oct 19 22:05:37 CEST 2026
+    Huge page backed regions
 
   -----------------------------------------------------------------------*/
 
@@ -24,6 +30,14 @@
 #else
 
 #include "clb_memory.h"
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <sys/mman.h>
+
+#if defined(MADV_HUGEPAGE) && !defined(USE_SYSTEM_MEM)
+#define MEM_HUGE_SUPPORT
+#endif
 
 
 /*-----------------------------------------------------------------------*/
@@ -41,27 +55,233 @@
 
 bool MemIsLow = false;
 
-Mem_p free_mem_list[MEM_ARR_SIZE] = {NULL};
+THREAD_LOCAL Mem_p free_mem_list[MEM_ARR_SIZE] = {NULL};
+THREAD_LOCAL long  free_mem_count[MEM_ARR_SIZE] = {0};
+THREAD_LOCAL long  free_mem_bytes = 0;
+THREAD_LOCAL long  mem_released_bytes = 0;
+
+/* Blocks freed while the free lists hold at least this many bytes go
+   back to the C library, so that memory freed after a peak can be
+   returned to the OS. The depot has the same bound. */
+long  MemFreeListLimit = MEM_FREE_LIST_LIMIT;
+
+/* Shared by all threads, protected by MemDepot.lock */
+MemDepotCell MemDepot = {0, 0, 0, {NULL}, {0}};
+
+/* The huge page range (base is NULL if it is not in use). Growing it
+   is protected by MemDepot.lock. Each thread allocates from its own
+   slice of it. */
+MemHugeCell MemHuge = {NULL, 0, 0, 0};
+static THREAD_LOCAL char *huge_top = NULL;
+static THREAD_LOCAL char *huge_end = NULL;
 
 #ifdef CLB_MEMORY_DEBUG
-long size_malloc_mem = 0;
-long size_malloc_count = 0;
-long size_free_mem = 0;
-long size_free_count = 0;
-long clb_free_count = 0;
-long secure_malloc_count = 0;
-long secure_malloc_mem = 0;
-long secure_realloc_count = 0;
-long secure_realloc_m_count = 0;
-long secure_realloc_f_count = 0;
+THREAD_LOCAL long size_malloc_mem = 0;
+THREAD_LOCAL long size_malloc_count = 0;
+THREAD_LOCAL long size_free_mem = 0;
+THREAD_LOCAL long size_free_count = 0;
+THREAD_LOCAL long clb_free_count = 0;
+THREAD_LOCAL long secure_malloc_count = 0;
+THREAD_LOCAL long secure_malloc_mem = 0;
+THREAD_LOCAL long secure_realloc_count = 0;
+THREAD_LOCAL long secure_realloc_m_count = 0;
+THREAD_LOCAL long secure_realloc_f_count = 0;
+
+/* Counters of threads that have terminated (under MemDepot.lock) */
+static long retired_debug_counts[10] = {0};
 #endif
 
+/* Class statistics of threads that have terminated (under
+   MemDepot.lock) */
+static MemClassStatCell retired_class_stats[MemClassCount];
+
 
 /*---------------------------------------------------------------------*/
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: depot_lock()
+//
+//   Acquire the depot lock (a simple spin lock - it is only held for
+//   the transfer of one batch of blocks).
+//
+// Global Variables: MemDepot
+//
+// Side Effects    : Synchronization
+//
+/----------------------------------------------------------------------*/
+
+static void depot_lock(void)
+{
+   while(__atomic_test_and_set(&MemDepot.lock, __ATOMIC_ACQUIRE))
+   {
+      while(__atomic_load_n(&MemDepot.lock, __ATOMIC_RELAXED))
+      {
+         /* Spin */
+      }
+   }
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: depot_unlock()
+//
+//   Release the depot lock.
+//
+// Global Variables: MemDepot
+//
+// Side Effects    : Synchronization
+//
+/----------------------------------------------------------------------*/
+
+static void depot_unlock(void)
+{
+   __atomic_clear(&MemDepot.lock, __ATOMIC_RELEASE);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: depot_put()
+//
+//   Move up to max blocks from the thread's free list for size to the
+//   depot (or to the C library if the depot is full and the block is
+//   not from the huge page range). The caller has to hold the
+//   lock. Return the number of blocks moved.
+//
+// Global Variables: free_mem_list[], MemDepot
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long depot_put(size_t size, long max)
+{
+   Mem_p handle;
+   long  moved = 0;
+
+   while(moved < max && free_mem_list[size])
+   {
+      handle = free_mem_list[size];
+      free_mem_list[size] = handle->next;
+      if(MemDepot.bytes < MemFreeListLimit || MemHugeOwns(handle))
+      {
+         handle->next = MemDepot.list[size];
+         MemDepot.list[size] = handle;
+         MemDepot.bytes += size;
+         __atomic_store_n(&MemDepot.count[size], MemDepot.count[size]+1,
+                          __ATOMIC_RELAXED);
+      }
+      else
+      {
+         mem_released_bytes += size;
+         FREE(handle);
+      }
+      moved++;
+   }
+   free_mem_count[size] -= moved;
+   free_mem_bytes -= moved*size;
+
+   return moved;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: flush_list()
+//
+//   Give all blocks on *list to the C library, except for those from
+//   the huge page range, which remain on the list. Return the number
+//   of remaining blocks.
+//
+// Global Variables: MemHuge
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long flush_list(Mem_p *list)
+{
+   Mem_p handle, kept = NULL;
+   long  res = 0;
+
+   while(*list)
+   {
+      handle = *list;
+      *list = handle->next;
+      if(MemHugeOwns(handle))
+      {
+         handle->next = kept;
+         kept = handle;
+         res++;
+      }
+      else
+      {
+         FREE(handle);
+      }
+   }
+   *list = kept;
+
+   return res;
+}
+
+
+#ifdef MEM_HUGE_SUPPORT
+
+/*-----------------------------------------------------------------------
+//
+// Function: huge_new_slice()
+//
+//   Give the calling thread a new slice of the huge page range,
+//   making another region of the range accessible if
+//   necessary. Regions are only made writable on demand, so that
+//   they count against the data size limit only once they are
+//   used. Return false if the range is exhausted or the region cannot
+//   be committed.
+//
+// Global Variables: MemHuge, huge_top, huge_end
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool huge_new_slice(void)
+{
+   bool res = true;
+
+   depot_lock();
+   if(MemHuge.used+MEM_HUGE_PAGE > MemHuge.committed)
+   {
+      if(MemHuge.committed+MEM_HUGE_REGION > MemHuge.size ||
+         mprotect(MemHuge.base+MemHuge.committed, MEM_HUGE_REGION,
+                  PROT_READ|PROT_WRITE) != 0)
+      {
+         res = false;
+      }
+      else
+      {
+         madvise(MemHuge.base+MemHuge.committed, MEM_HUGE_REGION,
+                 MADV_HUGEPAGE);
+         MemHuge.committed += MEM_HUGE_REGION;
+      }
+   }
+   if(res)
+   {
+      huge_top = MemHuge.base+MemHuge.used;
+      huge_end = huge_top+MEM_HUGE_PAGE;
+      MemHuge.used += MEM_HUGE_PAGE;
+   }
+   depot_unlock();
+
+   return res;
+}
+
+#endif
+
+
 #ifdef CLB_MEMORY_DEBUG
 
 /*-----------------------------------------------------------------------
@@ -102,9 +322,11 @@ static long free_list_size(Mem_p list)
 //   Returns all memory kept in free_mem_list[] to the operation
 //   system. This is useful if a very different memory access pattern
 //   is expected (SizeFree() never reorganizes the memory
-//   automatically).
+//   automatically). Blocks from the huge page range stay on the free
+//   lists.
 //
-// Global Variables: free_mem_list[]
+// Global Variables: free_mem_list[], free_mem_count[],
+//                   free_mem_bytes, mem_released_bytes
 //
 // Side Effects    : Memory operations
 //
@@ -113,18 +335,216 @@ static long free_list_size(Mem_p list)
 void MemFlushFreeList(void)
 {
    int f;
-   void* handle;
+   long kept;
 
    VERBOUT("MemFlushFreeList() called for cleanup or reorganization\n");
    for(f = 0;f<MEM_ARR_SIZE;f++)
    {
-      while(free_mem_list[f])
+      kept = flush_list(&free_mem_list[f]);
+      free_mem_bytes -= (free_mem_count[f]-kept)*f;
+      mem_released_bytes += (free_mem_count[f]-kept)*f;
+      free_mem_count[f] = kept;
+   }
+
+   if(MemDepot.bytes)
+   {
+      depot_lock();
+      for(f = 0;f<MEM_ARR_SIZE;f++)
       {
-         handle = (void*)free_mem_list[f];
-         free_mem_list[f] = free_mem_list[f]->next;
-         FREE(handle);
+         kept = flush_list(&MemDepot.list[f]);
+         MemDepot.bytes -= (MemDepot.count[f]-kept)*f;
+         mem_released_bytes += (MemDepot.count[f]-kept)*f;
+         __atomic_store_n(&MemDepot.count[f], kept, __ATOMIC_RELAXED);
       }
+      depot_unlock();
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemDepotRefill()
+//
+//   Slow path of SizeMallocReal(): The thread's free list for size is
+//   empty, so move a batch of blocks from the depot to it. Return a
+//   block (taken from the depot if possible, otherwise freshly
+//   allocated).
+//
+// Global Variables: free_mem_list[], MemDepot
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void* MemDepotRefill(size_t size)
+{
+   Mem_p handle;
+   long  moved = 0;
+
+   assert(size>=MEM_ARR_MIN_INDEX && size<MEM_ARR_SIZE);
+   assert(!free_mem_list[size]);
+
+   depot_lock();
+   while(moved < MEM_DEPOT_BATCH && MemDepot.list[size])
+   {
+      handle = MemDepot.list[size];
+      MemDepot.list[size] = handle->next;
+      handle->next = free_mem_list[size];
+      free_mem_list[size] = handle;
+      moved++;
    }
+   MemDepot.bytes -= moved*size;
+   __atomic_store_n(&MemDepot.count[size], MemDepot.count[size]-moved,
+                    __ATOMIC_RELAXED);
+   depot_unlock();
+
+   if(!moved)
+   {
+      handle = SecureMalloc(size);
+      assert((handle->test = MEM_RSET_PATTERN, true));
+      return handle;
+   }
+   handle = free_mem_list[size];
+   free_mem_list[size] = handle->next;
+   free_mem_count[size] += moved-1;
+   free_mem_bytes += (moved-1)*size;
+   assert(handle->test == MEM_FREE_PATTERN);
+   assert((handle->test = MEM_RSET_PATTERN, true));
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemDepotDrain()
+//
+//   Move a batch of blocks from the thread's overfull free list for
+//   size to the depot, where other threads can pick them up.
+//
+// Global Variables: free_mem_list[], MemDepot
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void MemDepotDrain(size_t size)
+{
+   depot_lock();
+   depot_put(size, MEM_DEPOT_BATCH);
+   depot_unlock();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemThreadInit()
+//
+//   Register a new thread (other than the main thread) with the
+//   memory management. From now on, overfull free lists are shared
+//   via the depot.
+//
+// Global Variables: MemDepot
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void MemThreadInit(void)
+{
+   __atomic_add_fetch(&MemDepot.threads, 1, __ATOMIC_RELAXED);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemThreadExit()
+//
+//   Hand over all free blocks and the statistics of the calling
+//   thread to the depot. Has to be called by every thread that called
+//   MemThreadInit() before it terminates.
+//
+// Global Variables: free_mem_list[], MemDepot, MemClassStats
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void MemThreadExit(void)
+{
+   long f;
+
+   depot_lock();
+   for(f = MEM_ARR_MIN_INDEX; f<MEM_ARR_SIZE; f++)
+   {
+      depot_put(f, LONG_MAX);
+   }
+   assert(free_mem_bytes == 0);
+   for(f = 0; f<MemClassCount; f++)
+   {
+      retired_class_stats[f].bytes += MemClassStats[f].bytes;
+      retired_class_stats[f].count += MemClassStats[f].count;
+      MemClassStats[f].bytes = 0;
+      MemClassStats[f].count = 0;
+   }
+#ifdef CLB_MEMORY_DEBUG
+   retired_debug_counts[0] += size_malloc_mem;
+   retired_debug_counts[1] += size_malloc_count;
+   retired_debug_counts[2] += size_free_mem;
+   retired_debug_counts[3] += size_free_count;
+   retired_debug_counts[4] += clb_free_count;
+   retired_debug_counts[5] += secure_malloc_count;
+   retired_debug_counts[6] += secure_malloc_mem;
+   retired_debug_counts[7] += secure_realloc_count;
+   retired_debug_counts[8] += secure_realloc_m_count;
+   retired_debug_counts[9] += secure_realloc_f_count;
+#endif
+   depot_unlock();
+   __atomic_sub_fetch(&MemDepot.threads, 1, __ATOMIC_RELAXED);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemTrim()
+//
+//   Ask the C library to return unused memory to the OS. With glibc,
+//   all completely free pages inside the heap are released (via
+//   madvise(MADV_DONTNEED)), not only the top of the heap. This is a
+//   no-op for other C libraries.
+//
+// Global Variables: mem_released_bytes
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void MemTrim(void)
+{
+#ifdef __GLIBC__
+   malloc_trim(0);
+#endif
+   mem_released_bytes = 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemFreeListBytes()
+//
+//   Return the number of bytes currently retained in
+//   free_mem_list[].
+//
+// Global Variables: free_mem_bytes
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long MemFreeListBytes(void)
+{
+   assert(free_mem_bytes >= 0);
+   return free_mem_bytes;
 }
 
 
@@ -342,7 +762,9 @@ long* IntArrayAlloc(int size)
 //
 // Function: MemDebugPrintStats()
 //
-//   Print information about allocated and deallocated memory.
+//   Print information about allocated and deallocated memory. The
+//   counters of terminated threads are added to those of the calling
+//   thread first.
 //
 // Global Variables: size_malloc_mem, size_malloc_count,
 //                   size_free_mem, size_free_count
@@ -353,6 +775,20 @@ long* IntArrayAlloc(int size)
 
 void MemDebugPrintStats(FILE* out)
 {
+   depot_lock();
+   size_malloc_mem        += retired_debug_counts[0];
+   size_malloc_count      += retired_debug_counts[1];
+   size_free_mem          += retired_debug_counts[2];
+   size_free_count        += retired_debug_counts[3];
+   clb_free_count         += retired_debug_counts[4];
+   secure_malloc_count    += retired_debug_counts[5];
+   secure_malloc_mem      += retired_debug_counts[6];
+   secure_realloc_count   += retired_debug_counts[7];
+   secure_realloc_m_count += retired_debug_counts[8];
+   secure_realloc_f_count += retired_debug_counts[9];
+   memset(retired_debug_counts, 0, sizeof(retired_debug_counts));
+   depot_unlock();
+
    fprintf(out,
            "\n# -------------------------------------------------\n");
    fprintf(out,
@@ -417,6 +853,225 @@ void MemFreeListPrint(FILE* out)
 #endif
 #endif
 
+/*-----------------------------------------------------------------------*/
+/*          Accounting of live objects per allocation class              */
+/*-----------------------------------------------------------------------*/
+
+THREAD_LOCAL MemClassStatCell MemClassStats[MemClassCount] = {{0, 0, 0}};
+
+const char* MemClassNames[MemClassCount] =
+{
+   "Terms",
+   "Clauses",
+   "Literals",
+   "Evaluations",
+   "PDT nodes",
+   "FV index nodes",
+   "PTree cells",
+   "Stacks",
+   "Ground units"
+};
+
+bool MemHugeClass[MemClassCount] = {false};
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: huge_pages_in_use()
+//
+//   Return the number of bytes of the process that are currently
+//   backed by transparent huge pages, or -1 if this is unknown.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads /proc
+//
+/----------------------------------------------------------------------*/
+
+static long huge_pages_in_use(void)
+{
+   FILE *in = fopen("/proc/self/smaps_rollup", "r");
+   char line[256];
+   long res = -1;
+
+   if(!in)
+   {
+      return res;
+   }
+   while(fgets(line, sizeof(line), in))
+   {
+      if(sscanf(line, "AnonHugePages: %ld kB", &res) == 1)
+      {
+         res *= 1024;
+         break;
+      }
+   }
+   fclose(in);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemHugeEnable()
+//
+//   Reserve an address range for huge page backed memory and allocate
+//   the cells of the long-lived, heavily traversed classes (terms,
+//   clauses, literals, indices) from it from now on. The range is
+//   advised for transparent huge pages, which reduces TLB misses on
+//   the pointer chasing that dominates term and index traversal
+//   (where THP is in "madvise" mode, this is required to get huge
+//   pages at all). Memory from the range is reused via the free
+//   lists, but never returned to the OS. Return false (and leave
+//   everything unchanged) if this is not supported or the range
+//   cannot be reserved.
+//
+// Global Variables: MemHuge, MemHugeClass
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool MemHugeEnable(void)
+{
+#ifdef MEM_HUGE_SUPPORT
+   long  size = MEM_HUGE_RESERVE+MEM_HUGE_PAGE;
+   char* base = MAP_FAILED;
+
+   if(MemHuge.base)
+   {
+      return true;
+   }
+   while(size >= 16*MEM_HUGE_REGION)
+   {
+      base = mmap(NULL, size, PROT_NONE,
+                  MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE, -1, 0);
+      if(base != MAP_FAILED)
+      {
+         break;
+      }
+      size /= 2;
+   }
+   if(base == MAP_FAILED)
+   {
+      return false;
+   }
+   /* Align to huge page boundaries, the unaligned head is simply not
+      used */
+   MemHuge.size = (size-MEM_HUGE_PAGE)&~(MEM_HUGE_REGION-1);
+   MemHuge.base = (char*)(((unsigned long)base+MEM_HUGE_PAGE-1)&
+                          ~(unsigned long)(MEM_HUGE_PAGE-1));
+   MemHugeClass[MemClassTerm]    = true;
+   MemHugeClass[MemClassClause]  = true;
+   MemHugeClass[MemClassEqn]     = true;
+   MemHugeClass[MemClassPDT]     = true;
+   MemHugeClass[MemClassFVIndex] = true;
+   return true;
+#else
+   return false;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemHugeMalloc()
+//
+//   Return a block of size bytes, preferably from the huge page
+//   range. Blocks on the free lists are reused first, new blocks are
+//   carved from the thread's current slice. Blocks are released with
+//   SizeFree() as usual.
+//
+// Global Variables: MemHuge, free_mem_list[]
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void* MemHugeMalloc(size_t size)
+{
+#ifdef MEM_HUGE_SUPPORT
+   Mem_p handle;
+   size_t bsize = MEM_HUGE_ALIGNED(size);
+
+   if(size<MEM_ARR_MIN_INDEX || size>=MEM_ARR_SIZE ||
+      free_mem_list[size] || MemDepotHasBlocks(size) || !MemHuge.base)
+   {
+      return SizeMalloc(size);
+   }
+   if(UNLIKELY(bsize > (size_t)(huge_end-huge_top)) && !huge_new_slice())
+   {
+      return SizeMalloc(size);
+   }
+   handle = (Mem_p)huge_top;
+   huge_top += bsize;
+   assert((handle->test = MEM_RSET_PATTERN, true));
+#ifdef CLB_MEMORY_DEBUG
+   size_malloc_mem+=size;
+   size_malloc_count++;
+#endif
+   return handle;
+#else
+   return SizeMalloc(size);
+#endif
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemClassStatsPrint()
+//
+//   Print the current and peak memory use of each allocation class
+//   and the memory retained in the free lists. Current values include
+//   terminated threads, peak values are those of the calling thread.
+//
+// Global Variables: MemClassStats, MemClassNames, free_mem_bytes,
+//                   MemDepot
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void MemClassStatsPrint(FILE* out)
+{
+   int  i;
+   long bytes = 0, count = 0, cls_bytes, cls_count;
+
+   fprintf(out, "# Memory by allocation class (live objects, bytes, peak bytes):\n");
+   for(i=0; i<MemClassCount; i++)
+   {
+      cls_bytes = MemClassStats[i].bytes;
+      cls_count = MemClassStats[i].count;
+#ifndef USE_NEWMEM
+      cls_bytes += retired_class_stats[i].bytes;
+      cls_count += retired_class_stats[i].count;
+#endif
+      fprintf(out, "# %-16s: %10ld %12ld %12ld\n",
+              MemClassNames[i],
+              cls_count,
+              cls_bytes,
+              MemClassStats[i].peak);
+      bytes += cls_bytes;
+      count += cls_count;
+   }
+   fprintf(out, "# %-16s: %10ld %12ld\n", "Total classified", count, bytes);
+#ifndef USE_NEWMEM
+   fprintf(out, "# %-16s: %23ld\n", "Free lists",
+           MemFreeListBytes()+MemDepot.bytes);
+   if(MemHuge.base)
+   {
+      fprintf(out, "# %-16s: %23ld\n", "Huge range used", MemHuge.used);
+      fprintf(out, "# %-16s: %23ld\n", "Huge range mapped",
+              MemHuge.committed);
+   }
+#endif
+   if((bytes = huge_pages_in_use()) > 0)
+   {
+      fprintf(out, "# %-16s: %23ld\n", "In huge pages", bytes);
+   }
+}
+
 /*-----------------------------------------------------------------------*/
 /*                       Ende des Files                                  */
 /*-----------------------------------------------------------------------*/
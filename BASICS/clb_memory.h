@@ -10,6 +10,15 @@
   groundwork it also implements secure versions of standard functions
   making use of memory allocation.
 
+  The free lists are private to each thread, so the fast paths need
+  no synchronization. A block may be freed by a different thread
+  than the one that allocated it (it simply ends up in the free list
+  of the freeing thread). While additional threads are running,
+  threads hand over batches of blocks from overfull lists to a
+  shared, locked depot, and refill empty lists from there. Threads
+  other than the main thread have to call MemThreadInit() and
+  MemThreadExit().
+
   Copyright 1998-2017 by the author.
   This code is released under the GNU General Public Licence and
   the GNU Lesser General Public License.
@@ -19,6 +28,15 @@
   Changes
 
   Created: Wed Aug 13 21:56:20 MET DST 1997
+  Mon Oct 19 19:40:02 CEST 2026
+    Always-on accounting of live objects per allocation class and of
+    blocks retained in the free lists.
+  Mon Oct 19 20:31:45 CEST 2026
+    Bounded free list retention, returning memory to the OS.
+  Mon Oct 19 21:18:09 CEST 2026
+    Per-thread free lists with a shared depot.
+  Mon Oct 19 22:05:37 CEST 2026
+    Huge page backed regions for selected allocation classes.
 
   -----------------------------------------------------------------------*/
 
@@ -56,9 +74,67 @@ typedef struct memcell
 #define MEM_FREE_PATTERN 0xFAFBFAFA
 #define MEM_RSET_PATTERN 0x00000000
 
+/* Default for MemFreeListLimit */
+#define MEM_FREE_LIST_LIMIT (256*1024*1024L)
+/* Trim the C library heap when this much memory has been handed back
+   to it since the last trim */
+#define MEM_TRIM_THRESHOLD  (64*1024*1024L)
+/* Number of blocks moved between a thread and the depot at once */
+#define MEM_DEPOT_BATCH     64
+/* With several threads, longer lists are drained into the depot */
+#define MEM_THREAD_CACHE_MAX (4*MEM_DEPOT_BATCH)
+
+typedef struct memdepotcell
+{
+   int   lock;
+   int   threads;       /* Running threads besides the main thread */
+   long  bytes;
+   Mem_p list[MEM_ARR_SIZE];
+   long  count[MEM_ARR_SIZE];
+}MemDepotCell, *MemDepot_p;
+
 extern bool MemIsLow;
-extern Mem_p free_mem_list[]; /* Exported for use by inline
-                               * functions/Macros */
+extern THREAD_LOCAL Mem_p free_mem_list[]; /* Exported for use by
+                                            * inline
+                                            * functions/Macros */
+extern THREAD_LOCAL long  free_mem_count[]; /* Number of blocks in
+                                               each list */
+extern THREAD_LOCAL long  free_mem_bytes;   /* Bytes in all lists */
+extern THREAD_LOCAL long  mem_released_bytes; /* Freed past the bound
+                                                 since the last
+                                                 MemTrim() */
+extern long  MemFreeListLimit; /* Bound for free_mem_bytes */
+extern MemDepotCell MemDepot;
+
+/* Optional huge page backed memory (see MemHugeEnable()): A large
+   address range is reserved once and made accessible region by
+   region. Threads carve blocks from private 2 MB slices. Blocks from
+   this range are never given to free(). */
+
+#define MEM_HUGE_PAGE     (2*1024*1024L)
+#define MEM_HUGE_REGION   (16*MEM_HUGE_PAGE)   /* Committed at once */
+#define MEM_HUGE_RESERVE  (1L<<36)             /* Reserved (64 GB) */
+#define MEM_HUGE_ALIGN    16
+#define MEM_HUGE_ALIGNED(size) \
+   (((size)+MEM_HUGE_ALIGN-1)&~(size_t)(MEM_HUGE_ALIGN-1))
+
+typedef struct memhugecell
+{
+   char *base;       /* Start of the reserved range, 2 MB aligned */
+   long size;        /* Size of the reserved range */
+   long committed;   /* Bytes made accessible */
+   long used;        /* Bytes handed out to threads */
+}MemHugeCell;
+
+extern MemHugeCell MemHuge;
+
+#define MemHugeOwns(ptr) \
+   ((unsigned long)((char*)(ptr)-MemHuge.base) < (unsigned long)MemHuge.size)
+
+#define MemDepotHasBlocks(size) \
+   __atomic_load_n(&MemDepot.count[(size)], __ATOMIC_RELAXED)
+#define MemThreadsActive() \
+   __atomic_load_n(&MemDepot.threads, __ATOMIC_RELAXED)
 
 static __inline__ void* SizeMallocReal(size_t size);
 static __inline__ void  SizeFreeReal(void* junk, size_t size);
@@ -102,6 +178,13 @@ static __inline__ void  SizeFreeReal(void* junk, size_t size);
 #endif
 
 void  MemFlushFreeList(void);
+long  MemFreeListBytes(void);
+void  MemTrim(void);
+#define MemTrimDue() (mem_released_bytes >= MEM_TRIM_THRESHOLD)
+void* MemDepotRefill(size_t size);
+void  MemDepotDrain(size_t size);
+void  MemThreadInit(void);
+void  MemThreadExit(void);
 void* SecureMalloc(size_t size);
 void* SecureRealloc(void *ptr, size_t size);
 char* SecureStrdup(const char* source);
@@ -113,16 +196,16 @@ long* IntArrayAlloc(int size);
 
 #ifdef CLB_MEMORY_DEBUG
 void MemDebugPrintStats(FILE* out);
-extern long size_malloc_mem;
-extern long size_malloc_count;
-extern long size_free_mem;
-extern long size_free_count;
-extern long clb_free_count;
-extern long secure_malloc_count;
-extern long secure_malloc_mem;
-extern long secure_realloc_count;
-extern long secure_realloc_m_count;
-extern long secure_realloc_f_count;
+extern THREAD_LOCAL long size_malloc_mem;
+extern THREAD_LOCAL long size_malloc_count;
+extern THREAD_LOCAL long size_free_mem;
+extern THREAD_LOCAL long size_free_count;
+extern THREAD_LOCAL long clb_free_count;
+extern THREAD_LOCAL long secure_malloc_count;
+extern THREAD_LOCAL long secure_malloc_mem;
+extern THREAD_LOCAL long secure_realloc_count;
+extern THREAD_LOCAL long secure_realloc_m_count;
+extern THREAD_LOCAL long secure_realloc_f_count;
 void MemFreeListPrint(FILE* out);
 #undef FREE
 #define FREE(junk) assert(junk); clb_free_count++; free(junk); junk=NULL
@@ -154,7 +237,7 @@ void MemFreeListPrint(FILE* out);
 //   free-list. This block is freeable with free(), and in all
 //   respects behaves like a normal malloc'ed block.
 //
-// Global Variables: free_mem_list[]
+// Global Variables: free_mem_list[], MemDepot
 //
 // Side Effects    : Memory operations
 //
@@ -170,6 +253,13 @@ static __inline__ void* SizeMallocReal(size_t size)
       assert((free_mem_list[size]->test = MEM_RSET_PATTERN, true));
       handle = free_mem_list[size];
       free_mem_list[size] = free_mem_list[size]->next;
+      free_mem_count[size]--;
+      free_mem_bytes -= size;
+   }
+   else if(size>=MEM_ARR_MIN_INDEX && size<MEM_ARR_SIZE &&
+           UNLIKELY(MemDepotHasBlocks(size)))
+   {
+      handle = MemDepotRefill(size);
    }
    else
    {
@@ -200,9 +290,11 @@ static __inline__ void* SizeMallocReal(size_t size)
 //  should only give blocks to SizeFree() that have been allocated
 //  with malloc(size) or SizeMalloc(size). Giving blocks that are to
 //  big wastes memory, blocks that are to small will result in more
-//  serious trouble (segmentation faults).
+//  serious trouble (segmentation faults). If the free lists already
+//  hold MemFreeListLimit bytes, the block is returned to the C
+//  library instead (unless it belongs to the huge page range).
 //
-// Global Variables: free_mem_list[]
+// Global Variables: free_mem_list[], MemFreeListLimit, MemDepot
 //
 // Side Effects    : Memory operations
 //
@@ -216,15 +308,27 @@ static __inline__ void SizeFreeReal(void* junk, size_t size)
    printf("\nBlock %p D: size %zd\n", junk, size);
 #endif
 
-   if(size>=MEM_ARR_MIN_INDEX && size<MEM_ARR_SIZE)
+   if(size>=MEM_ARR_MIN_INDEX && size<MEM_ARR_SIZE &&
+      (LIKELY(free_mem_bytes < MemFreeListLimit) || MemHugeOwns(junk)))
    {
       ((Mem_p)junk)->next = free_mem_list[size];
       free_mem_list[size] = (Mem_p)junk;
+      free_mem_count[size]++;
+      free_mem_bytes += size;
       assert(free_mem_list[size]->test != MEM_FREE_PATTERN);
       assert((free_mem_list[size]->test = MEM_FREE_PATTERN));
+      if(UNLIKELY(free_mem_count[size] > MEM_THREAD_CACHE_MAX) &&
+         UNLIKELY(MemThreadsActive()))
+      {
+         MemDepotDrain(size);
+      }
    }
    else
    {
+      if(size<MEM_ARR_SIZE)
+      {
+         mem_released_bytes += size;
+      }
       FREE(junk);
    }
 
@@ -235,6 +339,62 @@ static __inline__ void SizeFreeReal(void* junk, size_t size)
 }
 
 #endif
+
+/*---------------------------------------------------------------------*/
+/*          Accounting of live objects per allocation class            */
+/*---------------------------------------------------------------------*/
+
+/* Allocation classes for the most numerous data types. Allocations
+   that are not explicitly classified are not counted here (but show
+   up in the totals of the free lists and the RSS). */
+
+typedef enum
+{
+   MemClassTerm,     /* Term cells and argument arrays */
+   MemClassClause,   /* Clause cells */
+   MemClassEqn,      /* Literals */
+   MemClassEval,     /* Evaluation cells */
+   MemClassPDT,      /* Nodes of perfect discrimination trees */
+   MemClassFVIndex,  /* Nodes of feature vector indices */
+   MemClassPTree,    /* Pointer tree cells */
+   MemClassStack,    /* Stack cells and stack areas */
+   MemClassGroundUnits, /* Ground unit index cells and buckets */
+   MemClassCount     /* Number of classes, not a class */
+}MemClass;
+
+typedef struct memclassstatcell
+{
+   long bytes;  /* Currently allocated */
+   long count;  /* Currently allocated objects */
+   long peak;   /* Maximal value of bytes */
+}MemClassStatCell, *MemClassStat_p;
+
+extern THREAD_LOCAL MemClassStatCell MemClassStats[];
+extern const char*      MemClassNames[];
+extern bool             MemHugeClass[]; /* Classes allocated from huge
+                                           page backed memory */
+
+#define MemClassNoteAlloc(cls, size)                                    \
+   (MemClassStats[(cls)].count++,                                       \
+    (MemClassStats[(cls)].bytes+=(long)(size))>MemClassStats[(cls)].peak? \
+    (MemClassStats[(cls)].peak=MemClassStats[(cls)].bytes):0)
+#define MemClassNoteFree(cls, size)                                     \
+   (MemClassStats[(cls)].count--,                                       \
+    MemClassStats[(cls)].bytes-=(long)(size))
+
+/* Versions of SizeMalloc()/SizeFree() that account the memory to an
+   allocation class */
+#define SizeMallocClass(size, cls) (MemClassNoteAlloc((cls),(size)), \
+                                    UNLIKELY(MemHugeClass[(cls)])?   \
+                                    MemHugeMalloc(size):             \
+                                    SizeMalloc(size))
+#define SizeFreeClass(junk, size, cls)                                  \
+   do{MemClassNoteFree((cls),(size)); SizeFree(junk, size);}while(0)
+
+void  MemClassStatsPrint(FILE* out);
+bool  MemHugeEnable(void);
+void* MemHugeMalloc(size_t size);
+
 #endif
 
 /*---------------------------------------------------------------------*/
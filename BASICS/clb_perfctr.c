@@ -0,0 +1,202 @@
+/*-----------------------------------------------------------------------
+
+  File  : clb_perfctr.c
+
+  Author: agent (agent@local)
+
+  Contents
+
+  Registration, reset and output of performance counters. See
+  clb_perfctr.h for the measurement functions.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  Created: Mon Oct 19 10:12:43 CEST 2026
+
+  -----------------------------------------------------------------------*/
+
+#include "clb_perfctr.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+#ifdef INSTRUMENT_PERF_CTR
+bool PerfCtrsEnabled = true;
+#else
+bool PerfCtrsEnabled = false;
+#endif
+
+/* All counters that have been used at least once, in order of first
+   use. */
+
+static PerfCtr_p registered_ctrs = NULL;
+static PerfCtr_p *registered_tail = &registered_ctrs;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrRegister()
+//
+//   Add a counter to the list of counters reported by
+//   PerfCtrsPrintJSON(). Does nothing for already registered
+//   counters.
+//
+// Global Variables: registered_ctrs, registered_tail
+//
+// Side Effects    : Changes list
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrRegister(PerfCtr_p ctr)
+{
+   if(!ctr->registered)
+   {
+      ctr->registered = true;
+      ctr->next = NULL;
+      *registered_tail = ctr;
+      registered_tail = &(ctr->next);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrReset()
+//
+//   Reset all measurements of a counter (but keep it registered).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes ctr
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrReset(PerfCtr_p ctr)
+{
+   int i;
+
+   ctr->total = 0;
+   ctr->start = 0;
+   ctr->calls = 0;
+   for(i=0; i<PERF_CTR_HIST_SIZE; i++)
+   {
+      ctr->hist[i] = 0;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrsResetAll()
+//
+//   Reset all registered counters.
+//
+// Global Variables: registered_ctrs
+//
+// Side Effects    : Changes counters
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrsResetAll(void)
+{
+   PerfCtr_p handle;
+
+   for(handle = registered_ctrs; handle; handle = handle->next)
+   {
+      PerfCtrReset(handle);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrPrint()
+//
+//   Print a counter as a comment line in E's usual statistics
+//   format.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrPrint(FILE* out, PerfCtr_p ctr)
+{
+   char name[64];
+
+   snprintf(name, 64, "(%s)", ctr->name);
+   fprintf(out, "# PC%-34s : %f (%ld calls)\n",
+           name, ((double)ctr->total)/1000000000.0, ctr->calls);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrsPrintJSON()
+//
+//   Print all registered counters as a JSON object. Times are in
+//   nanoseconds, "histogram" has one entry per log2-bucket of the
+//   duration of individual measurements (bucket i counts durations
+//   in [2^i, 2^(i+1)) ns), with trailing empty buckets omitted.
+//
+// Global Variables: registered_ctrs
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrsPrintJSON(FILE* out)
+{
+   PerfCtr_p handle;
+   int       i, last;
+   char      *sep = "";
+
+   fprintf(out, "{\n  \"unit\": \"ns\",\n  \"counters\": {");
+   for(handle = registered_ctrs; handle; handle = handle->next)
+   {
+      fprintf(out, "%s\n    \"%s\": {\"calls\": %ld, \"total\": %lld, "
+              "\"histogram\": [",
+              sep, handle->name, handle->calls, handle->total);
+      for(last = PERF_CTR_HIST_SIZE-1; last>=0 && !handle->hist[last]; last--)
+      {
+         /* Skip empty buckets */
+      }
+      for(i=0; i<=last; i++)
+      {
+         fprintf(out, "%s%ld", i?", ":"", handle->hist[i]);
+      }
+      fprintf(out, "]}");
+      sep = ",";
+   }
+   fprintf(out, "\n  }\n}\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,161 @@
+/*-----------------------------------------------------------------------
+
+  File  : clb_perfctr.h
+
+  Author: agent (agent@local)
+
+  Contents
+
+  Lightweight, runtime-switchable performance counters. Each counter
+  accumulates monotonic time (in nanoseconds), the number of
+  completed measurements, and a log2-histogram of the duration of
+  individual measurements. If counters are disabled (the default
+  unless INSTRUMENT_PERF_CTR is defined), PERF_CTR_ENTRY() and
+  PERF_CTR_EXIT() cost one well-predicted test of a global flag.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  Created: Mon Oct 19 10:12:43 CEST 2026
+
+  -----------------------------------------------------------------------*/
+
+#ifndef CLB_PERFCTR
+
+#define CLB_PERFCTR
+
+#include <time.h>
+#include <clb_defines.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Bucket i counts measurements with a duration in [2^i, 2^(i+1))
+   ns, the last bucket collects everything longer. */
+
+#define PERF_CTR_HIST_SIZE 40
+
+typedef struct perfctrcell
+{
+   const char         *name;
+   long long          total;      /* Accumulated time in ns */
+   long long          start;      /* Time stamp of last entry */
+   long               calls;      /* Completed measurements */
+   long               hist[PERF_CTR_HIST_SIZE];
+   bool               registered; /* In the global list? */
+   struct perfctrcell *next;
+}PerfCtrCell, *PerfCtr_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern bool PerfCtrsEnabled;
+
+#define PERF_CTR_DEFINE(name)  PerfCtrCell name = {#name, 0, 0, 0, {0}, false, NULL}
+#define PERF_CTR_DECL(name)    extern PerfCtrCell name
+#define PERF_CTR_RESET(name)   PerfCtrReset(&(name))
+#define PERF_CTR_ENTRY(name)   do{if(UNLIKELY(PerfCtrsEnabled))\
+                                  {PerfCtrEntry(&(name));}}while(0)
+#define PERF_CTR_EXIT(name)    do{if(UNLIKELY(PerfCtrsEnabled))\
+                                  {PerfCtrExit(&(name));}}while(0)
+#define PERF_CTR_PRINT(out, name) do{if(PerfCtrsEnabled)\
+                                  {PerfCtrPrint((out), &(name));}}while(0)
+
+static __inline__ long long PerfCtrNow(void);
+static __inline__ void      PerfCtrEntry(PerfCtr_p ctr);
+static __inline__ void      PerfCtrExit(PerfCtr_p ctr);
+
+void PerfCtrRegister(PerfCtr_p ctr);
+void PerfCtrReset(PerfCtr_p ctr);
+void PerfCtrsResetAll(void);
+void PerfCtrPrint(FILE* out, PerfCtr_p ctr);
+void PerfCtrsPrintJSON(FILE* out);
+
+
+/*---------------------------------------------------------------------*/
+/*                     Inline Functions                                */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrNow()
+//
+//   Return a monotonic time stamp in nanoseconds.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ long long PerfCtrNow(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec*1000000000ll+ts.tv_nsec;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrEntry()
+//
+//   Start a measurement.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes ctr
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void PerfCtrEntry(PerfCtr_p ctr)
+{
+   ctr->start = PerfCtrNow();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrExit()
+//
+//   Finish a measurement and account for it. Counters are registered
+//   with the global list on first use, so that only counters that
+//   actually measured something show up in the output.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes ctr
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void PerfCtrExit(PerfCtr_p ctr)
+{
+   long long delta = PerfCtrNow()-ctr->start;
+   int       bucket;
+
+   if(UNLIKELY(!ctr->registered))
+   {
+      PerfCtrRegister(ctr);
+   }
+   bucket = delta>0?(63-__builtin_clzll(delta)):0;
+   bucket = MIN(bucket, PERF_CTR_HIST_SIZE-1);
+   ctr->hist[bucket]++;
+   ctr->total += delta;
+   ctr->calls++;
+}
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -66,9 +66,9 @@ void __attribute__ ((noinline)) PStackGrow(PStack_p stack)
       /* Emulate Realloc-Functionality for use of SizeMalloc() */
       old_size = stack->size;
       stack->size = stack->size*2;
-      tmp = SizeMalloc(stack->size * sizeof(IntOrP));
+      tmp = PStackArrayAlloc(stack->size);
       memcpy(tmp, stack->stack, old_size*sizeof(IntOrP));
-      SizeFree(stack->stack, old_size * sizeof(IntOrP));
+      PStackArrayFree(stack->stack, old_size);
       stack->stack = tmp;
 }
 
@@ -49,8 +49,14 @@ typedef struct pstackcell
                                    take care */
 
 
-#define PStackCellAlloc() (PStackCell*)SizeMalloc(sizeof(PStackCell))
-#define PStackCellFree(junk)         SizeFree(junk, sizeof(PStackCell))
+#define PStackCellAlloc() (PStackCell*)SizeMallocClass(sizeof(PStackCell), \
+                                                      MemClassStack)
+#define PStackCellFree(junk)         SizeFreeClass(junk, sizeof(PStackCell), \
+                                                   MemClassStack)
+#define PStackArrayAlloc(size) \
+   (IntOrP*)SizeMallocClass((size)*sizeof(IntOrP), MemClassStack)
+#define PStackArrayFree(junk, size) \
+   SizeFreeClass(junk, (size)*sizeof(IntOrP), MemClassStack)
 
 #ifdef CONSTANT_MEM_ESTIMATE
 #define PSTACK_AVG_MEM 68
@@ -69,6 +75,7 @@ static __inline__ void     PStackReset(PStack_p stack);
 static __inline__ void     PStackPushInt(PStack_p stack, long val);
 static __inline__ void     PStackPushP(PStack_p stack, void* val);
 #define  PStackGetSP(stack) ((stack)->current)
+#define  PStackSetSP(stack, sp) ((stack)->current = (sp))
 #define  PStackGetTopSP(stack) ((stack)->current-1)
 
 static __inline__ IntOrP   PStackPop(PStack_p stack);
@@ -157,7 +164,7 @@ static __inline__ PStack_p PStackAlloc(void)
    handle = PStackCellAlloc();
    handle->size = PSTACK_DEFAULT_SIZE;
    handle->current = 0;
-   handle->stack = SizeMalloc(handle->size * sizeof(IntOrP));
+   handle->stack = PStackArrayAlloc(handle->size);
 
    return handle;
 }
@@ -182,7 +189,7 @@ static __inline__ PStack_p PStackVarAlloc(long size)
    handle = PStackCellAlloc();
    handle->size = size;
    handle->current = 0;
-   handle->stack = SizeMalloc(handle->size * sizeof(IntOrP));
+   handle->stack = PStackArrayAlloc(handle->size);
 
    return handle;
 }
@@ -205,7 +212,7 @@ static __inline__ void  PStackFree(PStack_p junk)
    assert(junk);
    assert(junk->stack);
 
-   SizeFree(junk->stack, junk->size * sizeof(IntOrP));
+   PStackArrayFree(junk->stack, junk->size);
    PStackCellFree(junk);
 }
 
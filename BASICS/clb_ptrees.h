@@ -64,8 +64,10 @@ typedef struct ptreecell
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
-#define PTreeCellAlloc()    (PTreeCell*)SizeMalloc(sizeof(PTreeCell))
-#define PTreeCellFree(junk) SizeFree(junk, sizeof(PTreeCell))
+#define PTreeCellAlloc()    (PTreeCell*)SizeMallocClass(sizeof(PTreeCell), \
+                                                    MemClassPTree)
+#define PTreeCellFree(junk) SizeFreeClass(junk, sizeof(PTreeCell), \
+                                          MemClassPTree)
 
 #ifdef CONSTANT_MEM_ESTIMATE
 #define PTREE_CELL_MEM 16
@@ -71,7 +71,8 @@ int ClauseCanonCompareRef(const void *clause1ref, const void* clause2ref)
 //
 // Function: ClauseRemoveLiteralRef()
 //
-//   Remove *lit from clause, adjusting counters as necessary.
+//   Remove *lit from clause, adjusting counters and the literal
+//   signature as necessary.
 //
 // Global Variables: -
 //
@@ -97,6 +98,7 @@ void ClauseRemoveLiteralRef(Clause_p clause, Eqn_p *lit)
    }
    clause->weight -= EqnStandardWeight(handle);
    EqnListDeleteElement(lit);
+   clause->lit_sig = ClauseLitSignature(clause);
 }
 
 
@@ -131,7 +133,8 @@ void ClauseRemoveLiteral(Clause_p clause, Eqn_p lit)
 //
 // Function: ClauseFlipLiteralSign()
 //
-//   Change the sign of lit, adjusting counters as necessary.
+//   Change the sign of lit, adjusting counters and the literal
+//   signature as necessary.
 //
 // Global Variables: -
 //
@@ -152,6 +155,7 @@ void ClauseFlipLiteralSign(Clause_p clause, Eqn_p lit)
       clause->pos_lit_no++;
    }
    EqnFlipProp(lit, EPIsPositive);
+   clause->lit_sig = ClauseLitSignature(clause);
 }
 
 
@@ -312,7 +316,8 @@ int ClauseRemoveACResolved(Clause_p clause)
 // Function: ClauseUnitSimplifyTest()
 //
 //   Return true if clause can be simplified by a top-simplify-reflect
-//   step with the (non-orientable) unit clause simplifier.
+//   step with the (non-orientable) unit clause simplifier. For ground
+//   simplifiers, only pointer comparisons are needed.
 //
 // Global Variables: -
 //
@@ -322,7 +327,7 @@ int ClauseRemoveACResolved(Clause_p clause)
 
 bool ClauseUnitSimplifyTest(Clause_p clause, Clause_p simplifier)
 {
-   bool positive,tmp;
+   bool positive,tmp,ground;
    EqnRef handle;
    Eqn_p  simpl;
 
@@ -337,12 +342,19 @@ bool ClauseUnitSimplifyTest(Clause_p clause, Clause_p simplifier)
       return 0;
    }
 
+   ground = EqnIsGround(simpl);
    handle = &(clause->literals);
 
    while(*handle)
    {
       tmp = EqnIsPositive(*handle);
-      if(XOR(positive,tmp)&&EqnSubsumeP(simpl,*handle))
+      if(XOR(positive,tmp)&&
+         (ground?
+          ((simpl->lterm == (*handle)->lterm &&
+            simpl->rterm == (*handle)->rterm) ||
+           (simpl->lterm == (*handle)->rterm &&
+            simpl->rterm == (*handle)->lterm)):
+          EqnSubsumeP(simpl,*handle)))
       {
          return true;
       }
@@ -408,7 +420,7 @@ Clause_p ClauseArchiveCopy(ClauseSet_p archive, Clause_p clause)
    archclause->info = clause->info;
    archclause->derivation = clause->derivation;
    clause->info       = NULL;
-   clause->derivation = NULL;
+   clause->derivation = 0;
    ClausePushDerivation(clause, DCCnfQuote, archclause, NULL);
    ClauseSetInsert(archive, archclause);
 
@@ -451,7 +463,9 @@ void ClauseSetArchiveCopy(ClauseSet_p archive, ClauseSet_p set)
 //
 //   Return true if the clause is orphaned, i.e. if one of the direct
 //   premises of the original generating inferences that generated it
-//   has been back-simplified.
+//   has been back-simplified. Clauses not created by a generating
+//   inference are recognized by their CPIsGenerated flag without
+//   looking at the derivation.
 //
 // Global Variables: -
 //
@@ -461,59 +475,15 @@ void ClauseSetArchiveCopy(ClauseSet_p archive, ClauseSet_p set)
 
 bool ClauseIsOrphaned(Clause_p clause)
 {
-   PStackPointer i = 1;
-   DerivationCode op;
-   Clause_p parent;
-
    assert(clause);
 
    //clause = follow_quote_chain(clause);
 
-   if(!clause->derivation)
-   {
-      return false;
-   }
-   if(PStackEmpty(clause->derivation))
+   if(!ClauseQueryProp(clause, CPIsGenerated))
    {
       return false;
    }
-
-   op = PStackElementInt(clause->derivation, 0);
-
-   if(!DCOpIsGenerating(op))
-   {
-      return false;
-   }
-   if(DCOpHasCnfArg1(op))
-   {
-      parent = PStackElementP(clause->derivation, 1);
-      if(ClauseQueryProp(parent,CPIsDead))
-      {
-         return true;
-      }
-      i++;
-   }
-   if(DCOpHasCnfArg2(op))
-   {
-      parent = PStackElementP(clause->derivation, 2);
-      if(ClauseQueryProp(parent,CPIsDead))
-      {
-         return true;
-      }
-      i++;
-   }
-   while(i<PStackGetSP(clause->derivation) &&
-         ((op = PStackElementInt(clause->derivation, i))==DCCnfAddArg))
-   {
-      i++;
-      parent = PStackElementP(clause->derivation, i);
-      if(ClauseQueryProp(parent,CPIsDead))
-      {
-         return true;
-      }
-      i++;
-   }
-   return false;
+   return ClauseDerivHasDeadPremise(clause);
 }
 
 
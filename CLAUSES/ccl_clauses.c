@@ -146,6 +146,68 @@ static bool term_query_var_prop(Term_p term, TermProperties query,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: clause_var_masks()
+//
+//   Compute the variable masks of the positive and negative literals
+//   of clause.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void clause_var_masks(Clause_p clause, VarMask *pos, VarMask *neg)
+{
+   Eqn_p handle;
+
+   *pos = 0;
+   *neg = 0;
+   for(handle=clause->literals; handle; handle = handle->next)
+   {
+      if(EqnIsPositive(handle))
+      {
+         *pos |= EqnVarMask(handle);
+      }
+      else
+      {
+         *neg |= EqnVarMask(handle);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: subst_keeps_var_codes()
+//
+//   Return true if subst only binds variables to (fresh) variables
+//   with the same f_code, i.e. if instantiating a clause with it
+//   (and reinserting into the clause term bank) is the identity.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool subst_keeps_var_codes(Subst_p subst)
+{
+   for(PStackPointer i=0; i<PStackGetSP(subst); i++)
+   {
+      Term_p var = PStackElementP(subst, i);
+
+      if(var->binding->f_code != var->f_code)
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: clause_copy_meta()
@@ -169,7 +231,7 @@ Clause_p clause_copy_meta(Clause_p clause)
    handle->set         = NULL;
    handle->properties  = clause->properties;
    handle->info        = NULL;
-   handle->derivation  = NULL;
+   handle->derivation  = 0;
    handle->feature_vec = NULL;
    handle->create_date = clause->create_date;
    handle->date        = clause->date;
@@ -273,10 +335,11 @@ Clause_p EmptyClauseAlloc(void)
    handle->neg_lit_no  = 0;
    handle->pos_lit_no  = 0;
    handle->weight      = 0;
+   handle->lit_sig     = 0;
    handle->evaluations = NULL;
    handle->properties  = CPIgnoreProps;
    handle->info        = NULL;
-   handle->derivation  = NULL;
+   handle->derivation  = 0;
    handle->create_date = 0;
    handle->date        = SysDateCreationTime();
    handle->proof_depth = 0;
@@ -675,7 +738,7 @@ void ClauseFree(Clause_p junk)
    ClauseInfoFree(junk->info);
    if(junk->derivation)
    {
-      PStackFree(junk->derivation);
+      DerivLogRelease(junk->derivation);
    }
    if(junk->feature_vec)
    {
@@ -760,6 +823,7 @@ bool ClauseIsSemEmpty(Clause_p clause)
 bool ClauseIsRangeRestricted(Clause_p clause)
 {
    Eqn_p    handle;
+   VarMask  pos, neg;
 
    if(ClauseIsPositive(clause))
    {
@@ -769,6 +833,15 @@ bool ClauseIsRangeRestricted(Clause_p clause)
    {
       return false;
    }
+   clause_var_masks(clause, &pos, &neg);
+   if((neg & ~pos) & ~VAR_MASK_OVERFLOW)
+   {
+      return false;
+   }
+   if(VarMaskIsExact(neg))
+   {
+      return true;
+   }
    for(handle=clause->literals; handle; handle = handle->next)
    {
       if(EqnIsNegative(handle))
@@ -823,6 +896,7 @@ bool ClauseIsRangeRestricted(Clause_p clause)
 bool ClauseIsAntiRangeRestricted(Clause_p clause)
 {
    Eqn_p    handle;
+   VarMask  pos, neg;
 
    if(ClauseIsNegative(clause))
    {
@@ -832,6 +906,15 @@ bool ClauseIsAntiRangeRestricted(Clause_p clause)
    {
       return false;
    }
+   clause_var_masks(clause, &pos, &neg);
+   if((pos & ~neg) & ~VAR_MASK_OVERFLOW)
+   {
+      return false;
+   }
+   if(VarMaskIsExact(pos))
+   {
+      return true;
+   }
    for(handle=clause->literals; handle; handle = handle->next)
    {
       if(EqnIsPositive(handle))
@@ -887,11 +970,21 @@ bool ClauseIsAntiRangeRestricted(Clause_p clause)
 bool ClauseIsTPTPRangeRestricted(Clause_p clause)
 {
    Eqn_p    handle;
+   VarMask  pos, neg;
 
    if(ClauseIsNegative(clause))
    {
       return true;
    }
+   clause_var_masks(clause, &pos, &neg);
+   if((pos & ~neg) & ~VAR_MASK_OVERFLOW)
+   {
+      return false;
+   }
+   if(VarMaskIsExact(pos))
+   {
+      return true;
+   }
    for(handle=clause->literals; handle; handle = handle->next)
    {
       if(EqnIsPositive(handle))
@@ -952,6 +1045,7 @@ bool ClauseIsStronglyRangeRestricted(Clause_p clause)
    FunCode   i;
    Term_p    current_var;
    PStack_p  vars_stack;
+   VarMask   pos, neg;
 
    if(ClauseIsEmpty(clause))
    {
@@ -966,6 +1060,16 @@ bool ClauseIsStronglyRangeRestricted(Clause_p clause)
       return false;
    }
 
+   clause_var_masks(clause, &pos, &neg);
+   if((pos ^ neg) & ~VAR_MASK_OVERFLOW)
+   {
+      return false;
+   }
+   if(VarMaskIsExact(pos|neg))
+   {
+      return true;
+   }
+
    assert(clause->literals);
    vars = clause->literals->bank->vars;
 
@@ -2027,7 +2131,7 @@ double ClauseFunWeight(Clause_p clause, double max_term_multiplier,
                        double max_literal_multiplier, double
                        pos_multiplier, long vweight, long flimit,
                        long *fweights, long default_fweight, double app_var_mult,
-                       long *typefreqs)
+                       long *typefreqs, TermWeightMemo_p memo)
 {
    Eqn_p  handle;
    double res = 0;
@@ -2038,7 +2142,7 @@ double ClauseFunWeight(Clause_p clause, double max_term_multiplier,
                               max_literal_multiplier, pos_multiplier,
                               vweight, flimit, fweights,
                               default_fweight, app_var_mult,
-                              typefreqs);
+                              typefreqs, memo);
    }
    return res;
 }
@@ -2167,6 +2271,47 @@ double ClauseStandardWeight(Clause_p clause)
    return res;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseLitSignature()
+//
+//   Compute a 64 bit signature of the literals of clause. For each
+//   literal side that is not headed by a variable, the bit selected
+//   by a hash of its top symbol and the literal's polarity is
+//   set. Matching preserves both, so if a clause subsumes another
+//   one, its signature is a subset of the other's, and variants have
+//   the same signature.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+uint64_t ClauseLitSignature(Clause_p clause)
+{
+   Eqn_p    handle;
+   uint64_t res = 0;
+   uint64_t polarity;
+
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      polarity = EqnIsPositive(handle);
+      if(!TermIsTopLevelVar(handle->lterm))
+      {
+         res |= 1ULL << ((((uint64_t)handle->lterm->f_code<<1 | polarity)*
+                          0x9E3779B97F4A7C15ULL)>>58);
+      }
+      if(!TermIsTopLevelVar(handle->rterm))
+      {
+         res |= 1ULL << ((((uint64_t)handle->rterm->f_code<<1 | polarity)*
+                          0x9E3779B97F4A7C15ULL)>>58);
+      }
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseOrientWeight()
@@ -2472,7 +2617,8 @@ int ClauseCmpByPtr(const void* clause1, const void* clause2)
 //
 // Function: ClauseNormalizeVars()
 //
-//   Destructively normalize variables in clause.
+//   Destructively normalize variables in clause. Ground clauses and
+//   clauses that are already normalized are left alone.
 //
 // Global Variables: -
 //
@@ -2482,24 +2628,36 @@ int ClauseCmpByPtr(const void* clause1, const void* clause2)
 
 Clause_p ClauseNormalizeVars(Clause_p clause, VarBank_p fresh_vars)
 {
-   Eqn_p tmplist;
+   Eqn_p   tmplist;
    Subst_p subst;
+   VarMask pos, neg;
 
    assert(!ClauseQueryProp(clause,CPIsDIndexed));
 
-   if(!ClauseIsEmpty(clause))
+   clause_var_masks(clause, &pos, &neg);
+   if(pos|neg)
    {
       subst = SubstAlloc();
       VarBankResetVCounts(fresh_vars);
 
       NormSubstClause(clause, subst, fresh_vars);
 
-      if(!SubstIsEmpty(subst))
+      if(!subst_keeps_var_codes(subst))
       {
          tmplist = EqnListCopy(clause->literals, clause->literals->bank);
          EqnListFree(clause->literals);
          clause->literals = tmplist;
       }
+      else
+      {
+         for(tmplist = clause->literals; tmplist; tmplist = tmplist->next)
+         {
+            if(!EqnIsOriented(tmplist))
+            {
+               EqnDelProp(tmplist, EPMaxIsUpToDate);
+            }
+         }
+      }
       SubstDelete(subst);
    }
    return clause;
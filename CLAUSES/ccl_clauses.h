@@ -26,6 +26,7 @@
 #include <ccl_neweval.h>
 #include <ccl_eqnlist.h>
 #include <ccl_clauseinfo.h>
+#include <ccl_derivlog.h>
 #include <clb_properties.h>
 
 /*---------------------------------------------------------------------*/
@@ -121,9 +122,13 @@ typedef enum
                                            * and hence can only be
                                            * rewritten in limited
                                            * ways. */
-   CPIsRelevant     = 2*CPLimitedRW       /* Clause is selected as
+   CPIsRelevant     = 2*CPLimitedRW,      /* Clause is selected as
                                            * relevant for a proof
                                            * attempt (used by SInE). */
+   CPIsGenerated    = 2*CPIsRelevant      /* The first derivation step
+                                           * is a generating inference,
+                                           * i.e. the clause can become
+                                           * an orphan. */
 }FormulaProperties;
 
 
@@ -146,11 +151,16 @@ typedef struct clause_cell
    long                  weight;      /* ClauseStandardWeight()
                                          precomputed at some points in
                                          the program */
+   uint64_t              lit_sig;     /* ClauseLitSignature(),
+                                         precomputed together with
+                                         weight */
    Eval_p                evaluations; /* List of evaluations */
    ClauseInfo_p          info;        /* Currently about source in
                                          input, NULL for derived clauses */
-   PStack_p              derivation;  /* Derivation of the clause for
-                                         proof reconstruction. */
+   long                  derivation;  /* Derivation of the clause for
+                                         proof reconstruction (last
+                                         segment in DerivLog, 0 if
+                                         none). */
    long                  create_date; /* At what iteration of the
                                          main loop has this
                                          clause been created? */
@@ -201,13 +211,15 @@ void ClauseSetTPTPType(Clause_p clause, FormulaProperties type);
 #define ClauseQueryCSSCPASource(clause)                         \
    (((clause)->properties&CP_CSSCPA_Mask)/CP_CSSCPA_1)
 
-#define ClauseCellAllocRaw() (ClauseCell*)SizeMalloc(sizeof(ClauseCell))
-#define ClauseCellFree(junk) SizeFree(junk, sizeof(ClauseCell))
+#define ClauseCellAllocRaw() (ClauseCell*)SizeMallocClass(sizeof(ClauseCell), \
+                                                         MemClassClause)
+#define ClauseCellFree(junk) SizeFreeClass(junk, sizeof(ClauseCell), \
+                                           MemClassClause)
 
 #ifdef CONSTANT_MEM_ESTIMATE
 #define CLAUSECELL_MEM 68
 #else
-#define CLAUSECELL_MEM (MEMSIZE(ClauseCell)+PSTACK_AVG_MEM)
+#define CLAUSECELL_MEM (MEMSIZE(ClauseCell)+DERIV_LOG_AVG_MEM)
 #endif
 
 Clause_p ClauseCellAlloc(void);
@@ -218,6 +230,8 @@ void     ClauseRecomputeLitCounts(Clause_p clause);
 
 
 #define  ClauseGCMarkTerms(clause) EqnListGCMarkTerms((clause)->literals)
+#define  ClauseGCMarkYoungTerms(clause)          \
+   EqnListGCMarkYoungTerms((clause)->literals)
 
 #define  ClauseLiteralNumber(clause)                    \
    ((clause)->pos_lit_no+(clause)->neg_lit_no)
@@ -345,7 +359,8 @@ double ClauseFunWeight(Clause_p clause, double max_term_multiplier,
                        double max_literal_multiplier, double
                        pos_multiplier, long vweight, long flimit,
                        long *fweights, long default_fweight,
-                       double app_var_mult, long* typefreqs);
+                       double app_var_mult, long* typefreqs,
+                       TermWeightMemo_p memo);
 
 double ClauseTermExtWeight(Clause_p clause, TermWeightExtension_p twe);
 
@@ -365,6 +380,18 @@ double ClauseSymTypeWeight(Clause_p clause, double
 
 
 double   ClauseStandardWeight(Clause_p clause);
+uint64_t ClauseLitSignature(Clause_p clause);
+
+/* Precompute the data subsumption relies on. Has to be called
+   whenever the literals of a clause that is checked for subsumption
+   have changed. */
+#define ClauseUpdateSubsumeInfo(clause)                   \
+   ((clause)->weight  = ClauseStandardWeight(clause),     \
+    (clause)->lit_sig = ClauseLitSignature(clause))
+
+/* Necessary condition for subsumer subsuming sub_candidate */
+#define ClauseLitSigSubset(subsumer, sub_candidate) \
+   (((subsumer)->lit_sig & ~(sub_candidate)->lit_sig) == 0)
 
 double   ClauseOrientWeight(Clause_p clause, double
                             unorientable_literal_multiplier,
@@ -414,9 +441,6 @@ Clause_p ClauseNormalizeVars(Clause_p clause, VarBank_p fresh_vars);
 long     ClauseCollectSubterms(Clause_p clause, PStack_p collector);
 long     ClauseReturnFCodes(Clause_p clause, PStack_p f_codes);
 
-#define CLAUSE_ENSURE_DERIVATION(clause)                                \
-   {if(!(clause)->derivation){(clause)->derivation=PStackVarAlloc(3);}}
-
 bool    ClauseIsUntyped(Clause_p clause);
 
 bool    ClauseQueryLiteral(Clause_p clause, bool (*query_fun)(Eqn_p));
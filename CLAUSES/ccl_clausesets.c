@@ -286,6 +286,10 @@ static void clause_set_extract_entry(Clause_p clause)
                               i);
       }
    }
+   if(UNLIKELY(clause->set->gc_cursor == clause))
+   {
+      clause->set->gc_cursor = clause->succ;
+   }
    clause->pred->succ = clause->succ;
    clause->succ->pred = clause->pred;
    clause->set->literals-=ClauseLiteralNumber(clause);
@@ -327,12 +331,14 @@ ClauseSet_p ClauseSetAlloc(void)
    handle->date = SysDateCreationTime();
    SysDateInc(&handle->date);
    handle->demod_index = NULL;
+   handle->ground_units = NULL;
    handle->fvindex = NULL;
 
    handle->eval_indices = PDArrayAlloc(4,4);
    handle->eval_no = 0;
 
    handle->identifier = DStrAlloc();
+   handle->gc_cursor = NULL;
 
    return handle;
 }
@@ -385,6 +391,10 @@ void ClauseSetFree(ClauseSet_p junk)
    {
       PDTreeFree(junk->demod_index);
    }
+   if(junk->ground_units)
+   {
+      GroundUnitIndexFree(junk->ground_units);
+   }
 
    if(junk->fvindex)
    {
@@ -479,6 +489,11 @@ void ClauseSetInsert(ClauseSet_p set, Clause_p newclause)
    newclause->set = set;
    set->members++;
    set->literals+=ClauseLiteralNumber(newclause);
+   if(UNLIKELY(set->gc_cursor))
+   {
+      /* The set may already have been marked */
+      ClauseGCMarkYoungTerms(newclause);
+   }
    if(newclause->evaluations)
    {
       for(i=0; i<newclause->evaluations->eval_no; i++)
@@ -527,7 +542,8 @@ long ClauseSetInsertSet(ClauseSet_p set, ClauseSet_p from)
 //
 // Function: ClauseSetPDTIndexedInsert()
 //
-//   Insert a demodulator into the set and the sets index.
+//   Insert a demodulator into the set and the sets index. It is
+//   also registered with the ground unit index.
 //
 // Global Variables: -
 //
@@ -558,6 +574,11 @@ void ClauseSetPDTIndexedInsert(ClauseSet_p set, Clause_p newclause)
       pos->pos     = NULL;
       PDTreeInsert(set->demod_index, pos);
    }
+   if(!set->ground_units)
+   {
+      set->ground_units = GroundUnitIndexAlloc();
+   }
+   GroundUnitIndexInsert(set->ground_units, newclause);
    ClauseSetProp(newclause, CPIsDIndexed);
 }
 
@@ -636,7 +657,7 @@ void ClauseSetIndexedInsertClauseSet(ClauseSet_p set, ClauseSet_p source)
    while(!ClauseSetEmpty(source))
    {
       handle = ClauseSetExtractFirst(source);
-      handle->weight = ClauseStandardWeight(handle);
+      ClauseUpdateSubsumeInfo(handle);
       ClauseSetIndexedInsertClause(set, handle);
    }
 }
@@ -674,6 +695,7 @@ Clause_p ClauseSetExtractEntry(Clause_p clause)
             PDTreeDelete(clause->set->demod_index,
                          clause->literals->rterm, clause);
          }
+         GroundUnitIndexDelete(clause->set->ground_units, clause);
          ClauseDelProp(clause, CPIsDIndexed);
       }
    }
@@ -874,7 +896,7 @@ void ClauseSetSort(ClauseSet_p set, ComparisonFunctionType cmp_fun)
 
    while((clause = ClauseSetExtractFirst(set)))
    {
-      clause->weight = ClauseStandardWeight(clause);
+      ClauseUpdateSubsumeInfo(clause);
       PStackPushP(stack, clause);
    }
    assert(ClauseSetEmpty(set));
@@ -2291,19 +2313,16 @@ void ClauseSetDerivationStackStatistics(ClauseSet_p set)
    Clause_p handle;
    long     i;
    PDArray_p dist = PDArrayAlloc(8,8);
+   PStack_p  derivation = PStackAlloc();
    double    sum = 0.0;
 
    for(handle = set->anchor->succ; handle!=set->anchor; handle = handle->succ)
    {
-      if(handle->derivation)
-      {
-         PDArrayElementIncInt(dist, PStackGetSP(handle->derivation), 1);
-      }
-      else
-      {
-         PDArrayElementIncInt(dist, 0, 1);
-      }
+      PStackReset(derivation);
+      PDArrayElementIncInt(dist,
+                           ClauseDerivationDecode(handle, derivation), 1);
    }
+   PStackFree(derivation);
    for(i=0; i<PDArraySize(dist); i++)
    {
       printf("# %5ld: %6ld\n", i, PDArrayElementInt(dist,i));
@@ -2359,7 +2378,7 @@ void ClauseSetDefaultWeighClauses(ClauseSet_p set)
 
    for(handle = set->anchor->succ; handle!=set->anchor; handle = handle->succ)
    {
-      handle->weight = ClauseStandardWeight(handle);
+      ClauseUpdateSubsumeInfo(handle);
    }
 }
 
@@ -27,6 +27,7 @@
 #include <ccl_fcvindexing.h>
 #include <ccl_tautologies.h>
 #include <ccl_pdtrees.h>
+#include <ccl_groundunits.h>
 #include <clb_plist.h>
 #include <clb_objtrees.h>
 
@@ -47,10 +48,15 @@ typedef struct clausesetcell
           is used to indicate ignoring of dates when
           checking for irreducability. */
    PDTree_p  demod_index; /* If used for demodulators */
+   GroundUnitIndex_p ground_units; /* Ground units of demod_index,
+                                      created with the first one */
    FVIAnchor_p fvindex; /* Used for non-unit subsumption */
    PDArray_p eval_indices;
    long      eval_no;
    DStr_p     identifier;
+   Clause_p  gc_cursor; /* Next clause to be marked by the running
+                           young term collection, NULL if the set
+                           does not take part in one */
 }ClauseSetCell, *ClauseSet_p;
 
 
@@ -68,6 +74,7 @@ typedef struct clausesetcell
             (((CLAUSECELL_DYN_MEM+EVAL_MEM((set)->eval_no))*(set)->members+\
             EQN_CELL_MEM*(set)->literals)+\
             PDTreeStorage(set->demod_index)+\
+            GroundUnitIndexStorage(set->ground_units)+\
        FVIndexStorage(set->fvindex))
 
 ClauseSet_p ClauseSetAlloc(void);
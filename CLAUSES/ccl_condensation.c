@@ -16,6 +16,8 @@ Contents
 Changes
 
 <1>     New
+<2> Mon Oct 19 09:29:58 CEST 2026
+        Skip pairs of different ground literals (variable masks)
 
 -----------------------------------------------------------------------*/
 
@@ -55,11 +57,18 @@ long CondensationSuccesses = 0;
 
 static bool try_condensation(Clause_p clause, Eqn_p l1, Eqn_p l2, bool swap)
 {
-   Subst_p  subst = SubstAlloc();
+   Subst_p  subst;
    Eqn_p    newlits;
    Clause_p cand;
    bool     res = false;
 
+   if(!(EqnVarMask(l1)|EqnVarMask(l2)) &&
+      !(l1->lterm == l2->lterm && l1->rterm == l2->rterm))
+   {
+      /* Different ground literals cannot be unified */
+      return false;
+   }
+   subst = SubstAlloc();
    if(LiteralUnifyOneWay(l1, l2, subst, false))
    {
       newlits = EqnListCopyExcept(clause->literals,l2, l1->bank);
@@ -67,14 +76,14 @@ static bool try_condensation(Clause_p clause, Eqn_p l1, Eqn_p l2, bool swap)
       EqnListRemoveDuplicates(newlits);
       EqnListRemoveResolved(&newlits);
       cand = ClauseAlloc(newlits);
-      cand->weight = ClauseStandardWeight(cand);
+      ClauseUpdateSubsumeInfo(cand);
       ClauseSubsumeOrderSortLits(cand);
       if(ClauseSubsumesClause(cand, clause))
       {
          EqnListFree(clause->literals);
          clause->literals = cand->literals;
          ClauseRecomputeLitCounts(clause);
-         clause->weight = ClauseStandardWeight(clause);
+         ClauseUpdateSubsumeInfo(clause);
          cand->literals = NULL;
          ClauseFree(cand);
 
@@ -161,7 +170,7 @@ bool Condense(Clause_p clause)
 
    if((clause->pos_lit_no > 1) || (clause->neg_lit_no >1))
    {
-      clause->weight = ClauseStandardWeight(clause);
+      ClauseUpdateSubsumeInfo(clause);
       ClauseSubsumeOrderSortLits(clause);
       while(CondenseOnce(clause))
       {
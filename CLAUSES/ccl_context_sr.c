@@ -65,7 +65,7 @@ int ClauseContextualSimplifyReflect(ClauseSet_p set, Clause_p clause)
    Clause_p subsumer;
    PStack_p lit_stack = ClauseToStack(clause);
 
-   clause->weight = ClauseStandardWeight(clause);
+   ClauseUpdateSubsumeInfo(clause);
 
    while(!PStackEmpty(lit_stack))
    {
@@ -274,7 +274,7 @@ FunCode GetDefinitions(DefStore_p store, Eqn_p litlist,
       Clause_p variant;
 
       def_clause = ClauseAlloc(EqnListFlatCopy(litlist));
-      def_clause->weight = ClauseStandardWeight(def_clause);
+      ClauseUpdateSubsumeInfo(def_clause);
       ClauseSubsumeOrderSortLits(def_clause);
 
       variant = ClauseSetFindVariantClause(store->def_clauses,
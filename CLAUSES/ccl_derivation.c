@@ -234,7 +234,7 @@ PStack_p derived_get_derivation(Derived_p derived)
 
    if(derived->clause)
    {
-      return derived->clause->derivation;
+      return derived->derivation;
    }
    else
    {
@@ -244,6 +244,185 @@ PStack_p derived_get_derivation(Derived_p derived)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: deriv_log_get_item()
+//
+//   Decode the derivation item (op-code with its arguments) at *pos
+//   in the derivation log, advance *pos past it and return the
+//   op-code.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static DerivationCode deriv_log_get_item(long *pos, IntOrP *arg1,
+                                         IntOrP *arg2)
+{
+   DerivationCode op = DerivLogGetNum(pos);
+
+   assert(op);
+   if(DCOpHasParentArg1(op))
+   {
+      arg1->p_val = DerivLogGetPtr(pos);
+   }
+   else if(DCOpHasNumArg1(op))
+   {
+      arg1->i_val = DerivLogGetNum(pos);
+   }
+   if(DCOpHasParentArg2(op))
+   {
+      arg2->p_val = DerivLogGetPtr(pos);
+   }
+   else if(DCOpHasNumArg2(op))
+   {
+      arg2->i_val = DerivLogGetNum(pos);
+   }
+   return op;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: deriv_log_decode()
+//
+//   Push the items of the derivation segment chain ending in seg onto
+//   res, oldest first, in the classical derivation stack format.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void deriv_log_decode(long seg, PStack_p res)
+{
+   long           pos, prev;
+   DerivationCode op;
+   IntOrP         arg1, arg2;
+
+   prev = DerivLogSegPrev(seg, &pos);
+   if(prev)
+   {
+      deriv_log_decode(prev, res);
+   }
+   while(!DerivLogAtSegEnd(pos))
+   {
+      op = deriv_log_get_item(&pos, &arg1, &arg2);
+      PStackPushInt(res, op);
+      if(DCOpHasParentArg1(op))
+      {
+         PStackPushP(res, arg1.p_val);
+      }
+      else if(DCOpHasNumArg1(op))
+      {
+         PStackPushInt(res, arg1.i_val);
+      }
+      if(DCOpHasParentArg2(op))
+      {
+         PStackPushP(res, arg2.p_val);
+      }
+      else if(DCOpHasNumArg2(op))
+      {
+         PStackPushInt(res, arg2.i_val);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: deriv_log_dead_premise()
+//
+//   Scan the derivation segment chain ending in seg for a dead
+//   premise of the initial generating inference (including the
+//   additional premises given by DCCnfAddArg items directly
+//   following it). Returns 1 if one is found, 0 if there is none,
+//   and -1 if the end of seg has been reached without a decision.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int deriv_log_dead_premise(long seg)
+{
+   long           pos, prev;
+   int            res;
+   DerivationCode op;
+   IntOrP         arg1, arg2;
+
+   prev = DerivLogSegPrev(seg, &pos);
+   if(prev)
+   {
+      res = deriv_log_dead_premise(prev);
+      if(res != -1)
+      {
+         return res;
+      }
+   }
+   else
+   {
+      op = deriv_log_get_item(&pos, &arg1, &arg2);
+      if(!DCOpIsGenerating(op))
+      {
+         return 0;
+      }
+      if((DCOpHasCnfArg1(op) && ClauseQueryProp((Clause_p)arg1.p_val, CPIsDead))||
+         (DCOpHasCnfArg2(op) && ClauseQueryProp((Clause_p)arg2.p_val, CPIsDead)))
+      {
+         return 1;
+      }
+   }
+   while(!DerivLogAtSegEnd(pos))
+   {
+      op = deriv_log_get_item(&pos, &arg1, &arg2);
+      if(op != DCCnfAddArg)
+      {
+         return 0;
+      }
+      if(ClauseQueryProp((Clause_p)arg1.p_val, CPIsDead))
+      {
+         return 1;
+      }
+   }
+   return -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_dummy_quote_parent()
+//
+//   If clause is justified only by quoting a single clause (or
+//   formula, if op is DCFofQuote), return that parent, otherwise
+//   NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void* clause_dummy_quote_parent(Clause_p clause, DerivationCode op)
+{
+   long   pos;
+   IntOrP arg1, arg2;
+
+   if(!clause->derivation ||
+      DerivLogSegPrev(clause->derivation, &pos) ||
+      deriv_log_get_item(&pos, &arg1, &arg2) != op ||
+      !DerivLogAtSegEnd(pos))
+   {
+      return NULL;
+   }
+   return arg1.p_val;
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -495,7 +674,7 @@ void DerivedSetInProof(Derived_p derived, bool in_proof)
 //
 // Global Variables:
 //
-// Side Effects    : May allocate new derivation stack.
+// Side Effects    : Extends the derivation log
 //
 /----------------------------------------------------------------------*/
 
@@ -505,20 +684,34 @@ void ClausePushDerivation(Clause_p clause, DerivationCode op,
    assert(clause);
    assert(op);
 
-   CLAUSE_ENSURE_DERIVATION(clause);
    assert(DCOpHasCnfArg1(op)||DCOpHasFofArg1(op)||!arg1);
    assert(DCOpHasCnfArg2(op)||DCOpHasFofArg2(op)||!arg2);
    assert(DCOpHasCnfArg1(op)||!DCOpHasCnfArg2(op));
+   assert(!DCOpHasParentArg1(op)||arg1);
+   assert(!DCOpHasParentArg2(op)||arg2);
 
-   PStackPushInt(clause->derivation, op);
+   if(!clause->derivation)
+   {
+      if(DCOpIsGenerating(op))
+      {
+         ClauseSetProp(clause, CPIsGenerated);
+      }
+      else
+      {
+         ClauseDelProp(clause, CPIsGenerated);
+      }
+   }
+   clause->derivation = DerivLogOpen(clause->derivation);
+   DerivLogPutNum(op);
    if(arg1)
    {
-      PStackPushP(clause->derivation, arg1);
+      DerivLogPutPtr(arg1);
       if(arg2)
       {
-         PStackPushP(clause->derivation, arg2);
+         DerivLogPutPtr(arg2);
       }
    }
+   DerivLogClose();
 }
 
 
@@ -531,7 +724,7 @@ void ClausePushDerivation(Clause_p clause, DerivationCode op,
 //
 // Global Variables:
 //
-// Side Effects    : May allocate new derivation stack.
+// Side Effects    : Extends the derivation log
 //
 /----------------------------------------------------------------------*/
 
@@ -539,13 +732,39 @@ void ClausePushACResDerivation(Clause_p clause, Sig_p sig)
 {
    assert(clause);
 
-   CLAUSE_ENSURE_DERIVATION(clause);
-
-   PStackPushInt(clause->derivation, DCACRes);
-   PStackPushInt(clause->derivation, PStackGetSP(sig->ac_axioms));
+   clause->derivation = DerivLogOpen(clause->derivation);
+   DerivLogPutNum(DCACRes);
+   DerivLogPutNum(PStackGetSP(sig->ac_axioms));
+   DerivLogClose();
    /* printf("Pushed: %d\n", PStackGetSP(sig->ac_axioms)); */
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseDerivationDecode()
+//
+//   Push the derivation of clause onto res as a derivation stack
+//   (op-codes, each followed by its arguments). Returns the number of
+//   items pushed.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long ClauseDerivationDecode(Clause_p clause, PStack_p res)
+{
+   PStackPointer start = PStackGetSP(res);
+
+   if(clause->derivation)
+   {
+      deriv_log_decode(clause->derivation, res);
+   }
+   return PStackGetSP(res)-start;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: WFormulaPushDerivation()
@@ -585,6 +804,26 @@ void WFormulaPushDerivation(WFormula_p form, DerivationCode op,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseDerivHasDeadPremise()
+//
+//   Return true if one of the premises of the generating inference
+//   that created clause is dead. Reads the derivation log in place.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool ClauseDerivHasDeadPremise(Clause_p clause)
+{
+   return clause->derivation &&
+      deriv_log_dead_premise(clause->derivation) == 1;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseIsEvalGC()
@@ -602,11 +841,19 @@ void WFormulaPushDerivation(WFormula_p form, DerivationCode op,
 
 bool ClauseIsEvalGC(Clause_p clause)
 {
+   long           pos;
+   DerivationCode op = DCNop;
+   IntOrP         arg1, arg2;
+
    if(clause->derivation)
    {
-      return PStackTopInt(clause->derivation)==DCCnfEvalGC;
+      DerivLogSegPrev(clause->derivation, &pos);
+      while(!DerivLogAtSegEnd(pos))
+      {
+         op = deriv_log_get_item(&pos, &arg1, &arg2);
+      }
    }
-   return false;
+   return op==DCCnfEvalGC;
 }
 
 
@@ -626,15 +873,7 @@ bool ClauseIsEvalGC(Clause_p clause)
 
 bool ClauseIsDummyQuote(Clause_p clause)
 {
-   if(clause->derivation)
-   {
-      if((PStackGetSP(clause->derivation)==2) &&
-         (PStackElementInt(clause->derivation, 0)==DCCnfQuote))
-      {
-         return true;
-      }
-   }
-   return false;
+   return clause_dummy_quote_parent(clause, DCCnfQuote)!=NULL;
 }
 
 
@@ -653,15 +892,7 @@ bool ClauseIsDummyQuote(Clause_p clause)
 
 bool ClauseIsDummyFOFQuote(Clause_p clause)
 {
-   if(clause->derivation)
-   {
-      if((PStackGetSP(clause->derivation)==2) &&
-         (PStackElementInt(clause->derivation, 0)==DCFofQuote))
-      {
-         return true;
-      }
-   }
-   return false;
+   return clause_dummy_quote_parent(clause, DCFofQuote)!=NULL;
 }
 
 
@@ -683,14 +914,13 @@ bool ClauseIsDummyFOFQuote(Clause_p clause)
 
 Clause_p ClauseDerivFindFirst(Clause_p clause)
 {
-   Clause_p parent = clause;
+   Clause_p parent = clause_dummy_quote_parent(clause, DCCnfQuote);
 
-   if(ClauseIsDummyQuote(clause))
+   if(parent)
    {
-      parent = PStackElementP(clause->derivation, 1);
-      parent = ClauseDerivFindFirst(parent);
+      return ClauseDerivFindFirst(parent);
    }
-   return parent;
+   return clause;
 }
 
 
@@ -994,11 +1224,34 @@ Derived_p DerivedAlloc(void)
    handle->ref_count = 0;
    handle->clause    = NULL;
    handle->formula   = NULL;
+   handle->derivation = NULL;
 
    return handle;
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: DerivedFree()
+//
+//   Free a DerivedCell (and the decoded derivation).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory  operations
+//
+/----------------------------------------------------------------------*/
+
+void DerivedFree(Derived_p junk)
+{
+   if(junk->derivation)
+   {
+      PStackFree(junk->derivation);
+   }
+   DerivedCellFree(junk);
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -1281,9 +1534,9 @@ void DerivedPCLPrint(FILE* out, Sig_p sig, Derived_p derived)
               PCLTypeStr(ClauseQueryTPTPType(derived->clause)));
       ClausePCLPrint(out, derived->clause, PCLFullTerms);
       fputs(" : ", out);
-      if(derived->clause->derivation)
+      if(derived->derivation)
       {
-         DerivationStackPCLPrint(out, sig, derived->clause->derivation);
+         DerivationStackPCLPrint(out, sig, derived->derivation);
       }
       else if(derived->clause->info)
       {
@@ -1343,10 +1596,10 @@ void DerivedTSTPPrint(FILE* out, Sig_p sig, Derived_p derived)
    {
       // fprintf(out, "%p: ", derived->clause);
       ClauseTSTPPrint(out, derived->clause, true, false);
-      if(derived->clause->derivation)
+      if(derived->derivation)
       {
          fprintf(out, ", ");
-         DerivationStackTSTPPrint(out, sig, derived->clause->derivation);
+         DerivationStackTSTPPrint(out, sig, derived->derivation);
       }
       else
       {
@@ -1530,7 +1783,7 @@ void DerivedDotPrint(FILE* out, Sig_p sig, Derived_p derived,
    if(derived->clause)
    {
       id = derived->clause->ident;
-      deriv = derived->clause->derivation;
+      deriv = derived->derivation;
       info  = derived->clause->info;
       if(ClauseIsEvalGC(derived->clause) &&
          ClauseQueryProp(derived->clause,CPIsProcessed))
@@ -1797,6 +2050,11 @@ Derived_p DerivationGetDerived(Derivation_p derivation, Clause_p clause,
       DerivedFree(handle);
       handle = tmp;
    }
+   else if(clause && clause->derivation)
+   {
+      handle->derivation = PStackVarAlloc(4);
+      ClauseDerivationDecode(clause, handle->derivation);
+   }
    return handle;
 }
 
@@ -2187,11 +2445,11 @@ void DerivationAnalyse(Derivation_p derivation)
          {
             derivation->clause_conjecture_count++;
          }
-         if(DerivStackIndicatesInitialClause(handle->clause->derivation))
+         if(DerivStackIndicatesInitialClause(handle->derivation))
          {
             derivation->initial_clause_count++;
          }
-         DerivStackCountSearchInferences(handle->clause->derivation,
+         DerivStackCountSearchInferences(handle->derivation,
                                          &(derivation->generating_inf_count),
                                          &(derivation->simplifying_inf_count));
       }
@@ -151,6 +151,7 @@ typedef struct derived_cell
    bool       is_fresh;
    Clause_p   clause;
    WFormula_p formula;
+   PStack_p   derivation; /* Decoded derivation of clause */
 }DerivedCell, *Derived_p;
 
 
@@ -205,11 +206,13 @@ void ClausePushDerivation(Clause_p clause, DerivationCode op,
                           void* arg1, void* arg2);
 
 void ClausePushACResDerivation(Clause_p clause, Sig_p sig);
+long ClauseDerivationDecode(Clause_p clause, PStack_p res);
 
 
 void WFormulaPushDerivation(WFormula_p form, DerivationCode op,
                             void* arg1, void* arg2);
 
+bool ClauseDerivHasDeadPremise(Clause_p clause);
 bool ClauseIsEvalGC(Clause_p clause);
 
 bool ClauseIsDummyQuote(Clause_p clause);
@@ -235,9 +238,9 @@ void DerivStackCountSearchInferences(PStack_p derivation,
 #define DerivedCellFree(junk) SizeFree(junk, sizeof(DerivedCell))
 
 Derived_p DerivedAlloc(void);
-#define DerivedFree(junk) DerivedCellFree(junk)
+void      DerivedFree(Derived_p junk);
 #define DerivedGetDerivstack(d)                                         \
-   ((d)->clause?(d)->clause->derivation:(d)->formula->derivation)
+   ((d)->clause?(d)->derivation:(d)->formula->derivation)
 
 bool DerivedInProof(Derived_p derived);
 void DerivedSetInProof(Derived_p derived, bool in_proof);
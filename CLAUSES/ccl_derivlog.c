@@ -0,0 +1,344 @@
+/*-----------------------------------------------------------------------
+
+  File  : ccl_derivlog.c
+
+  Author: agent (agent@local)
+
+  Contents
+
+  Management of the global derivation log. See ccl_derivlog.h for
+  the encoding.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Created:  Mon Oct 19 14:21:08 CEST 2026
+
+  -----------------------------------------------------------------------*/
+
+#include "ccl_derivlog.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+DerivLogCell DerivLog = {NULL, 0, 0, 0, 0, 0};
+
+#define DERIV_LOG_INIT_SIZE 65536
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: seg_cmp()
+//
+//   Compare two segment offsets stored in a PStack (for qsort()).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int seg_cmp(const void* s1, const void* s2)
+{
+   const IntOrP *seg1 = s1, *seg2 = s2;
+
+   return (seg1->i_val > seg2->i_val) - (seg1->i_val < seg2->i_val);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: seg_find()
+//
+//   Return the index of seg in the first n elements of the sorted
+//   stack segs, or -1 if it does not occur.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long seg_find(PStack_p segs, long n, long seg)
+{
+   long lo = 0, hi = n-1, mid, val;
+
+   while(lo <= hi)
+   {
+      mid = lo+(hi-lo)/2;
+      val = PStackElementInt(segs, mid);
+      if(val == seg)
+      {
+         return mid;
+      }
+      if(val < seg)
+      {
+         lo = mid+1;
+      }
+      else
+      {
+         hi = mid-1;
+      }
+   }
+   return -1;
+}
+
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogGrow()
+//
+//   Make sure that there is space for at least one more item in the
+//   log. The arena is registered memory and is released by
+//   RegMemCleanUp().
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogGrow(void)
+{
+   DerivLog.mem = RegMemProvide(DerivLog.mem, &DerivLog.size,
+                                MAX(DerivLog.top+DERIV_LOG_MAX_ITEM+1,
+                                    DERIV_LOG_INIT_SIZE));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogOpen()
+//
+//   Prepare appending items for a clause whose most recent segment
+//   starts at seg (0 if the clause has no derivation yet). If that
+//   segment is the last one in the log, it is reopened (its
+//   terminator is dropped). Otherwise a new segment linking back to
+//   seg is started. Returns the offset of the open segment, which
+//   becomes the new derivation reference of the clause. Every
+//   DerivLogOpen() has to be followed by DerivLogClose().
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long DerivLogOpen(long seg)
+{
+   long res;
+
+   if(seg && seg == DerivLog.last_seg)
+   {
+      assert(DerivLog.mem[DerivLog.top-1] == 0);
+      DerivLog.top--;
+      return seg;
+   }
+   if(!DerivLog.top)
+   {
+      DerivLog.top = 1;
+   }
+   res = DerivLog.top;
+   DerivLogPutNum(seg? res-seg : 0);
+   DerivLog.last_seg = res;
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogClose()
+//
+//   Terminate the currently open segment.
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogClose(void)
+{
+   if(UNLIKELY(DerivLog.top >= (long)DerivLog.size))
+   {
+      DerivLogGrow();
+   }
+   DerivLog.mem[DerivLog.top++] = 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogSegPrev()
+//
+//   Return the offset of the segment preceding seg in the same
+//   derivation (or 0 if seg is the first). *items is set to the
+//   position of the first item in seg.
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long DerivLogSegPrev(long seg, long *items)
+{
+   long back;
+
+   assert(seg);
+   *items = seg;
+   back = DerivLogGetNum(items);
+
+   return back? seg-back : 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogRelease()
+//
+//   Release all segments of the derivation ending in seg. Segments at
+//   the end of the log are reclaimed immediately (this is the common
+//   case for clauses that are discarded right after generation), the
+//   others are only accounted as garbage until the next
+//   DerivLogCompact().
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogRelease(long seg)
+{
+   long prev, pos;
+
+   while(seg)
+   {
+      prev = DerivLogSegPrev(seg, &pos);
+      while(DerivLog.mem[pos])
+      {
+         pos++;
+      }
+      pos++;
+      if(pos == DerivLog.top)
+      {
+         DerivLog.top = seg;
+         DerivLog.last_seg = 0;
+      }
+      else
+      {
+         DerivLog.garbage += pos-seg;
+      }
+      seg = prev;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogCompact()
+//
+//   Reclaim the garbage in the log. refs is a stack of pointers to
+//   (long) derivation references, and has to cover all live
+//   derivations. Live segments are slid towards the start of the log
+//   in their original order (so that back-links only get shorter and
+//   never need more bytes than before), and the references are
+//   updated. Returns the number of bytes reclaimed.
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : Moves segments, changes the values pointed to by
+//                   the elements of refs.
+//
+/----------------------------------------------------------------------*/
+
+long DerivLogCompact(PStack_p refs)
+{
+   PStack_p      segs = PStackAlloc(), new_segs = PStackAlloc();
+   PStackPointer i;
+   long          *ref, seg, prev, pos, end, dest, old_top, n;
+
+   for(i=0; i<PStackGetSP(refs); i++)
+   {
+      ref = PStackElementP(refs, i);
+      for(seg = *ref; seg; seg = prev)
+      {
+         PStackPushInt(segs, seg);
+         prev = DerivLogSegPrev(seg, &pos);
+      }
+   }
+   PStackSort(segs, seg_cmp);
+   n = PStackGetSP(segs);
+
+   old_top = DerivLog.top;
+   dest = 1;
+   for(i=0; i<n; i++)
+   {
+      seg = PStackElementInt(segs, i);
+      assert(!i || PStackElementInt(segs, i-1) < seg);
+      prev = DerivLogSegPrev(seg, &pos);
+      for(end = pos; DerivLog.mem[end]; end++)
+      {
+         /* Just find the terminator */
+      }
+      end++;
+      if(prev)
+      {
+         prev = seg_find(segs, i, prev);
+         assert(prev >= 0);
+         prev = dest-PStackElementInt(new_segs, prev);
+      }
+      /* The new back-link fits into the space of the old one */
+      DerivLog.top = dest;
+      DerivLogPutNum(prev);
+      assert(DerivLog.top <= pos);
+      memmove(DerivLog.mem+DerivLog.top, DerivLog.mem+pos, end-pos);
+      PStackPushInt(new_segs, dest);
+      dest = DerivLog.top+(end-pos);
+   }
+   DerivLog.top = n? dest : 0;
+
+   for(i=0; i<PStackGetSP(refs); i++)
+   {
+      ref = PStackElementP(refs, i);
+      if(*ref)
+      {
+         *ref = PStackElementInt(new_segs, seg_find(segs, n, *ref));
+      }
+   }
+   seg = DerivLog.last_seg? seg_find(segs, n, DerivLog.last_seg) : -1;
+   DerivLog.last_seg = (seg >= 0)? PStackElementInt(new_segs, seg) : 0;
+   DerivLog.garbage = 0;
+
+   PStackFree(new_segs);
+   PStackFree(segs);
+
+   return old_top-DerivLog.top;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
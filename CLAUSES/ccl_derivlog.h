@@ -0,0 +1,219 @@
+/*-----------------------------------------------------------------------
+
+  File  : ccl_derivlog.h
+
+  Author: agent (agent@local)
+
+  Contents
+
+  A compact, append-only log for clause derivations. All derivation
+  items (op-codes, numerical arguments, parent references) are
+  stored as variable-length integers in a single global byte
+  arena. A clause only holds the offset of its most recent
+  segment. Segments of the same clause are chained by a relative
+  back-link, and each segment is terminated by a zero byte (all
+  encoded items are non-zero). Segments of freed clauses are
+  reclaimed by sliding compaction.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Created:  Mon Oct 19 14:21:08 CEST 2026
+
+  -----------------------------------------------------------------------*/
+
+#ifndef CCL_DERIVLOG
+
+#define CCL_DERIVLOG
+
+#include <stdint.h>
+#include <limits.h>
+#include <clb_regmem.h>
+#include <clb_pstacks.h>
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+typedef struct deriv_log_cell
+{
+   unsigned char *mem;      /* The arena, offset 0 is never used */
+   size_t        size;      /* Allocated bytes */
+   long          top;       /* First unused byte */
+   long          last_seg;  /* Start of the last segment, 0 if it has
+                               been released */
+   long          garbage;   /* Bytes in segments of freed clauses
+                               that could not be reclaimed */
+   uintptr_t     base;      /* Reference address for pointers */
+}DerivLogCell, *DerivLog_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+/* Maximal encoded size of a single item */
+#define DERIV_LOG_MAX_ITEM  10
+
+/* All pointers stored in the log are at least this aligned */
+#define DERIV_LOG_PTR_SHIFT 3
+
+/* Rough average per clause, for memory estimates */
+#define DERIV_LOG_AVG_MEM   16
+
+extern DerivLogCell DerivLog;
+
+#define DerivLogStorage()  ((long)DerivLog.size)
+#define DerivLogUsed()     (DerivLog.top)
+#define DerivLogGarbage()  (DerivLog.garbage)
+#define DerivLogAtSegEnd(pos) (DerivLog.mem[(pos)]==0)
+
+/* Garbage below this is never worth a compaction */
+#define DERIV_LOG_COMPACT_MIN 262144
+
+/* True if at least half the log is garbage */
+#define DerivLogWantsCompaction()                       \
+   ((DerivLog.garbage > DERIV_LOG_COMPACT_MIN) &&       \
+    (2*DerivLog.garbage > DerivLog.top))
+
+void DerivLogGrow(void);
+long DerivLogOpen(long seg);
+void DerivLogClose(void);
+void DerivLogRelease(long seg);
+long DerivLogCompact(PStack_p refs);
+long DerivLogSegPrev(long seg, long *items);
+
+static __inline__ void          DerivLogPutNum(unsigned long val);
+static __inline__ unsigned long DerivLogGetNum(long *pos);
+static __inline__ void          DerivLogPutPtr(void* ptr);
+static __inline__ void*         DerivLogGetPtr(long *pos);
+
+
+/*---------------------------------------------------------------------*/
+/*                  Implementations as inline functions                */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogPutNum()
+//
+//   Append val to the log. The encoding (LEB128 of val+1) never
+//   contains a zero byte.
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void DerivLogPutNum(unsigned long val)
+{
+   unsigned char *dest;
+
+   if(UNLIKELY(DerivLog.top+DERIV_LOG_MAX_ITEM > (long)DerivLog.size))
+   {
+      DerivLogGrow();
+   }
+   dest = DerivLog.mem+DerivLog.top;
+   val++;
+   while(val >= 0x80)
+   {
+      *dest++ = (unsigned char)(val|0x80);
+      val >>= 7;
+   }
+   *dest++ = (unsigned char)val;
+   DerivLog.top = dest-DerivLog.mem;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogGetNum()
+//
+//   Decode the number at *pos and advance *pos past it.
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ unsigned long DerivLogGetNum(long *pos)
+{
+   unsigned char *src = DerivLog.mem+*pos;
+   unsigned long val = 0;
+   int shift = 0;
+
+   while(*src & 0x80)
+   {
+      val |= (unsigned long)(*src++ & 0x7f) << shift;
+      shift += 7;
+   }
+   val |= (unsigned long)(*src++) << shift;
+   *pos = src-DerivLog.mem;
+
+   assert(val);
+   return val-1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogPutPtr()
+//
+//   Append a pointer to the log, encoded as the zig-zag encoded
+//   (aligned) distance from a fixed reference address. Heap
+//   addresses are clustered, so this typically needs 3-5 bytes.
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void DerivLogPutPtr(void* ptr)
+{
+   long dist;
+
+   assert(ptr);
+   assert(!((uintptr_t)ptr & ((1<<DERIV_LOG_PTR_SHIFT)-1)));
+
+   if(UNLIKELY(!DerivLog.base))
+   {
+      DerivLog.base = (uintptr_t)ptr;
+   }
+   dist = ((intptr_t)ptr-(intptr_t)DerivLog.base)>>DERIV_LOG_PTR_SHIFT;
+   DerivLogPutNum(((unsigned long)dist<<1)^
+                  (unsigned long)(dist>>(sizeof(long)*CHAR_BIT-1)));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogGetPtr()
+//
+//   Decode the pointer at *pos and advance *pos past it.
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void* DerivLogGetPtr(long *pos)
+{
+   unsigned long val = DerivLogGetNum(pos);
+   long dist = (long)(val>>1)^-(long)(val&1);
+
+   return (void*)(DerivLog.base+((uintptr_t)dist<<DERIV_LOG_PTR_SHIFT));
+}
+
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -2407,7 +2407,7 @@ double EqnWeight(Eqn_p eq, double max_multiplier, long vweight, long
 // Function: EqnFunWeight()
 //
 //   As EqnWeight(), but use weighted FSum instead of plain term
-//   weight.
+//   weight. memo (if not NULL) is passed on to TermFsumWeight().
 //   Weight of applied variables is multiplied with app_var_mult.
 //
 // Global Variables:
@@ -2418,12 +2418,13 @@ double EqnWeight(Eqn_p eq, double max_multiplier, long vweight, long
 
 double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
                     long flimit, long *fweights, long default_fweight,
-                    double app_var_mult, long* typefreqs)
+                    double app_var_mult, long* typefreqs,
+                    TermWeightMemo_p memo)
 {
    double res;
 
    res = (double)TermFsumWeight(eq->rterm, vweight, flimit, fweights, default_fweight,
-                                typefreqs);
+                                typefreqs, memo);
    res = TERM_APPLY_APP_VAR_MULT(res, eq->rterm, app_var_mult);
 
    if(!EqnIsOriented(eq))
@@ -2432,7 +2433,7 @@ double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
    }
 
    res += TERM_APPLY_APP_VAR_MULT((double)TermFsumWeight(eq->lterm, vweight, flimit, fweights,
-                                                            default_fweight, typefreqs) * max_multiplier,
+                                                            default_fweight, typefreqs, memo) * max_multiplier,
                                      eq->lterm, app_var_mult);
 
    return res;
@@ -2777,13 +2778,14 @@ double  LiteralFunWeight(Eqn_p eq,
                          long *fweights,
                          long default_fweight,
                          double app_var_mult,
-                         long* typefreqs)
+                         long* typefreqs,
+                         TermWeightMemo_p memo)
 {
    double res;
 
    res = EqnFunWeight(eq, max_term_multiplier, vweight, flimit,
                       fweights, default_fweight, app_var_mult,
-                      typefreqs);
+                      typefreqs, memo);
 
    if(EqnIsMaximal(eq))
    {
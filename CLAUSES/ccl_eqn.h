@@ -128,14 +128,17 @@ extern bool EqnUseInfix; /* s = t or EQ(s = t)  ? */
 extern bool EqnFullEquationalRep; /* P(x) = $true ? */
 extern IOFormat OutputFormat;
 
-#define EqnCellAlloc()    (EqnCell*)SizeMalloc(sizeof(EqnCell))
-#define EqnCellFree(junk) SizeFree(junk, sizeof(EqnCell))
+#define EqnCellAlloc()    (EqnCell*)SizeMallocClass(sizeof(EqnCell), MemClassEqn)
+#define EqnCellFree(junk) SizeFreeClass(junk, sizeof(EqnCell), MemClassEqn)
 
 Eqn_p   EqnAlloc(Term_p lterm, Term_p rterm, TB_p bank, bool positive);
 void    EqnFree(Eqn_p junk);
 
 #define EqnGCMarkTerms(eqn) TBGCMarkTerm((eqn)->bank,(eqn)->lterm);     \
    TBGCMarkTerm((eqn)->bank,(eqn)->rterm)
+#define EqnGCMarkYoungTerms(eqn)                                        \
+   TBGCMarkYoungTerm((eqn)->bank,(eqn)->lterm);                         \
+   TBGCMarkYoungTerm((eqn)->bank,(eqn)->rterm)
 
 #define EqnSetProp(eqn, prop)  SetProp((eqn), (prop))
 #define EqnDelProp(eqn, prop)  DelProp((eqn), (prop))
@@ -179,6 +182,8 @@ void    EqnFree(Eqn_p junk);
 
 #define EqnIsGround(eq)                                         \
    (TBTermIsGround((eq)->lterm) && TBTermIsGround((eq)->rterm))
+#define EqnVarMask(eq)                                  \
+   (TermVarMask((eq)->lterm) | TermVarMask((eq)->rterm))
 #define EqnIsPureVar(eq)                                \
    (TermIsVar((eq)->lterm) && TermIsVar((eq)->rterm))
 #define EqnIsPartVar(eq)                                \
@@ -302,7 +307,8 @@ double  EqnWeight(Eqn_p eq, double max_multiplier, long vweight, long
 
 double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
                     long flimit, long *fweights, long default_fweight,
-                    double app_var_mult, long* typefreqs);
+                    double app_var_mult, long* typefreqs,
+                    TermWeightMemo_p memo);
 
 double  EqnNonLinearWeight(Eqn_p eq, double max_multiplier, long
                            vlweight, long vweight, long fweight, 
@@ -338,7 +344,8 @@ double  LiteralFunWeight(Eqn_p eq,
                          long *fweights,
                          long default_fweight,
                          double app_var_mult,
-                         long* typefreqs);
+                         long* typefreqs,
+                         TermWeightMemo_p memo);
 
 double  LiteralTermExtWeight(Eqn_p eq, TermWeightExtension_p twe);
 
@@ -60,6 +60,53 @@ EqnRef eqn_list_find_last(EqnRef list)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: eqn_list_unmark_unselected()
+//
+//   If list contains selected literals (and no pseudo-literals), all
+//   unselected literals are smaller than any selected one in the
+//   literal ordering (see LiteralCompare()), and hence neither
+//   maximal nor strictly maximal. Delete these properties from them
+//   without any term comparisons and return their number. Otherwise
+//   leave list unchanged and return 0.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes literal properties.
+//
+/----------------------------------------------------------------------*/
+
+static int eqn_list_unmark_unselected(Eqn_p list)
+{
+   Eqn_p handle;
+   bool  selected = false;
+   int   res = 0;
+
+   for(handle = list; handle; handle = handle->next)
+   {
+      if(EqnQueryProp(handle, EPPseudoLit))
+      {
+         return 0;
+      }
+      selected = selected || EqnIsSelected(handle);
+   }
+   if(!selected)
+   {
+      return 0;
+   }
+   for(handle = list; handle; handle = handle->next)
+   {
+      if(!EqnIsSelected(handle))
+      {
+         EqnDelProp(handle, EPIsMaximal|EPIsStrictlyMaximal);
+         res++;
+      }
+   }
+   return res;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -111,6 +158,29 @@ void EqnListGCMarkTerms(Eqn_p list)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: EqnListGCMarkYoungTerms()
+//
+//   Mark the young terms in the eqnlist for a young generation
+//   collection.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks terms
+//
+/----------------------------------------------------------------------*/
+
+void EqnListGCMarkYoungTerms(Eqn_p list)
+{
+   while(list)
+   {
+      EqnGCMarkYoungTerms(list);
+      list = list->next;
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: EqnListSetProp()
@@ -1044,7 +1114,9 @@ int EqnListOrient(OCB_p ocb, Eqn_p list)
 //
 //   Determine for each literal wether it is maximal or not. Returns
 //   number of maximal literals. Also determines strictly maximal
-//   literals.
+//   literals. Only literals not yet known to be dominated are
+//   compared, so after literal selection only the selected literals
+//   are.
 //
 // Global Variables: -
 //
@@ -1059,6 +1131,7 @@ int EqnListMaximalLiterals(OCB_p ocb, Eqn_p list)
    int res = 0;
 
    res = EqnListSetProp(list, EPIsMaximal|EPIsStrictlyMaximal);
+   res -= eqn_list_unmark_unselected(list);
    for(handle = list; handle; handle = handle->next)
    {
       for(stepper = handle->next; stepper; stepper = stepper->next)
@@ -42,6 +42,7 @@ New
 
 void    EqnListFree(Eqn_p list);
 void    EqnListGCMarkTerms(Eqn_p list);
+void    EqnListGCMarkYoungTerms(Eqn_p list);
 
 int     EqnListSetProp(Eqn_p list, EqnProperties prop);
 int     EqnListDelProp(Eqn_p list, EqnProperties prop);
@@ -18,6 +18,8 @@ Changes
 
 <1> Tue Jul  1 13:09:10 CEST 2003
     New
+<2> Mon Oct 19 05:03:45 CEST 2026
+    Flat leaves for small subtrees
 
 -----------------------------------------------------------------------*/
 
@@ -138,6 +140,15 @@ void fv_index_print(FILE* out, FVIndex_p index, bool fullterms, int level)
    {
       print_clauses(out, index->u1.clauses, level+1, fullterms);
    }
+   else if(index->flat)
+   {
+      for(long i=0; i<index->u1.leaf->size; i++)
+      {
+         print_lvl(out, level+1);
+         ClausePrint(out, index->u1.leaf->clauses[i], fullterms);
+         fprintf(out, " \n");
+      }
+   }
    else
    {
       IntMapIter_p iterator = IntMapIterAlloc(index->u1.successors, 0, LONG_MAX);
@@ -191,6 +202,225 @@ static FVIndex_p insert_empty_node(FVIndex_p node, FVIAnchor_p anchor, long key)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: fv_leaf_storage()
+//
+//   Return the memory used by leaf.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long fv_leaf_storage(FVLeaf_p leaf)
+{
+   return sizeof(FVLeafCell)+
+      leaf->alloc*(leaf->width*sizeof(FVFeature)+sizeof(Clause_p));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: make_flat_leaf()
+//
+//   Turn the empty node into a flat leaf for rows of width features.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void make_flat_leaf(FVIndex_p node, FVIAnchor_p anchor, long width)
+{
+   FVLeaf_p leaf = FVLeafCellAlloc();
+
+   assert(!node->final && !node->flat && !node->u1.successors);
+
+   leaf->size     = 0;
+   leaf->alloc    = 0;
+   leaf->width    = width;
+   leaf->features = NULL;
+   leaf->clauses  = NULL;
+
+   node->flat    = true;
+   node->u1.leaf = leaf;
+   anchor->storage += fv_leaf_storage(leaf);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fv_leaf_free()
+//
+//   Free a flat leaf.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void fv_leaf_free(FVLeaf_p junk)
+{
+   if(junk->alloc)
+   {
+      SizeFreeClass(junk->features,
+                    junk->alloc*junk->width*sizeof(FVFeature),
+                    MemClassFVIndex);
+      SizeFreeClass(junk->clauses, junk->alloc*sizeof(Clause_p),
+                    MemClassFVIndex);
+   }
+   FVLeafCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fv_leaf_add_row()
+//
+//   Append a row for clause to leaf and return the (uninitialized)
+//   feature array of the row.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static FVFeature* fv_leaf_add_row(FVLeaf_p leaf, FVIAnchor_p anchor,
+                                  Clause_p clause)
+{
+   FVFeature *features;
+   Clause_p  *clauses;
+   long      new_alloc;
+
+   if(leaf->size == leaf->alloc)
+   {
+      new_alloc = leaf->alloc? 2*leaf->alloc : 2;
+      features  = SizeMallocClass(new_alloc*leaf->width*sizeof(FVFeature),
+                                  MemClassFVIndex);
+      clauses   = SizeMallocClass(new_alloc*sizeof(Clause_p),
+                                  MemClassFVIndex);
+      if(leaf->alloc)
+      {
+         memcpy(features, leaf->features,
+                leaf->size*leaf->width*sizeof(FVFeature));
+         memcpy(clauses, leaf->clauses, leaf->size*sizeof(Clause_p));
+         SizeFreeClass(leaf->features,
+                       leaf->alloc*leaf->width*sizeof(FVFeature),
+                       MemClassFVIndex);
+         SizeFreeClass(leaf->clauses, leaf->alloc*sizeof(Clause_p),
+                       MemClassFVIndex);
+      }
+      anchor->storage -= fv_leaf_storage(leaf);
+      leaf->features = features;
+      leaf->clauses  = clauses;
+      leaf->alloc    = new_alloc;
+      anchor->storage += fv_leaf_storage(leaf);
+   }
+   leaf->clauses[leaf->size] = clause;
+   return FVLeafRow(leaf, leaf->size++);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fv_leaf_split()
+//
+//   Convert a flat leaf into an inner node, distributing its rows
+//   over new successor nodes by their first feature. The successors
+//   are flat leaves again (or final nodes if no features are left),
+//   they are split in turn when the next clause is inserted into
+//   them.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes index
+//
+/----------------------------------------------------------------------*/
+
+static void fv_leaf_split(FVIndex_p node, FVIAnchor_p anchor)
+{
+   FVLeaf_p  leaf = node->u1.leaf;
+   FVIndex_p succ;
+   FVFeature *row;
+   long      i;
+
+   assert(node->flat);
+
+   node->flat = false;
+   node->u1.successors = NULL;
+
+   for(i=0; i<leaf->size; i++)
+   {
+      row  = FVLeafRow(leaf, i);
+      succ = IntMapGetVal(node->u1.successors, row[0]);
+      if(!succ)
+      {
+         succ = insert_empty_node(node, anchor, row[0]);
+         if(leaf->width > 1)
+         {
+            make_flat_leaf(succ, anchor, leaf->width-1);
+         }
+         else
+         {
+            succ->final = true;
+         }
+      }
+      succ->clause_count++;
+      if(succ->flat)
+      {
+         memcpy(fv_leaf_add_row(succ->u1.leaf, anchor, leaf->clauses[i]),
+                row+1, succ->u1.leaf->width*sizeof(FVFeature));
+      }
+      else
+      {
+         PTreeStore(&(succ->u1.clauses), leaf->clauses[i]);
+      }
+   }
+   anchor->storage -= fv_leaf_storage(leaf);
+   fv_leaf_free(leaf);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fv_leaf_delete()
+//
+//   Delete the row of clause from leaf (moving the last row into its
+//   place). Return true if clause was found.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes leaf
+//
+/----------------------------------------------------------------------*/
+
+static bool fv_leaf_delete(FVLeaf_p leaf, Clause_p clause)
+{
+   long i, last = leaf->size-1;
+
+   for(i=0; i<leaf->size; i++)
+   {
+      if(leaf->clauses[i] == clause)
+      {
+         if(i != last)
+         {
+            leaf->clauses[i] = leaf->clauses[last];
+            memcpy(FVLeafRow(leaf, i), FVLeafRow(leaf, last),
+                   leaf->width*sizeof(FVFeature));
+         }
+         leaf->size = last;
+         return true;
+      }
+   }
+   return false;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -255,6 +485,7 @@ FVIndex_p FVIndexAlloc(void)
    handle->u1.clauses    = NULL;
    handle->u1.successors = NULL;
    handle->final         = false;
+   handle->flat          = false;
 
    return handle;
 }
@@ -285,6 +516,10 @@ void FVIndexFree(FVIndex_p junk)
       {
          PTreeFree(junk->u1.clauses);
       }
+      else if(junk->flat)
+      {
+         fv_leaf_free(junk->u1.leaf);
+      }
       else if(junk->u1.successors)
       {
          iter = IntMapIterAlloc(junk->u1.successors, 0, LONG_MAX);
@@ -375,6 +610,7 @@ FVIndex_p FVIndexGetNextNonEmptyNode(FVIndex_p node, long key)
    FVIndex_p handle;
 
    assert(!node->final);
+   assert(!node->flat);
 
    handle = IntMapGetVal(node->u1.successors, key);
    if(handle&&handle->clause_count)
@@ -390,7 +626,9 @@ FVIndex_p FVIndexGetNextNonEmptyNode(FVIndex_p node, long key)
 //
 // Function: FVIndexInsert()
 //
-//   Insert a FreqVector (with associated clause) into the index.
+//   Insert a FreqVector (with associated clause) into the index. New
+//   subtrees start out as flat leaves, which are split when they grow
+//   beyond FVINDEX_LEAF_MAX clauses.
 //
 // Global Variables: -
 //
@@ -417,12 +655,29 @@ void FVIndexInsert(FVIAnchor_p index, FreqVector_p vec_clause)
    {
       assert(!handle->final);
 
+      if(handle->flat)
+      {
+         FVLeafPackQuery(fv_leaf_add_row(handle->u1.leaf, index,
+                                         vec_clause->clause),
+                         vec_clause, i);
+         if(handle->u1.leaf->size > FVINDEX_LEAF_MAX)
+         {
+            fv_leaf_split(handle, index);
+         }
+         PERF_CTR_EXIT(FVIndexTimer);
+         return;
+      }
       newnode = IntMapGetVal(handle->u1.successors, vec_clause->array[i]);
       if(!newnode)
       {
          newnode = insert_empty_node(handle,
                                      index,
                                      vec_clause->array[i]);
+         if(i+1 < vec_clause->size &&
+            vec_clause->size-(i+1) <= FVINDEX_LEAF_WIDTH)
+         {
+            make_flat_leaf(newnode, index, vec_clause->size-(i+1));
+         }
       }
       handle = newnode;
       handle->clause_count++;
@@ -466,6 +721,10 @@ bool FVIndexDelete(FVIAnchor_p index, Clause_p clause)
    for(i=0; i<vec->size; i++)
    {
       assert(!handle->final);
+      if(handle->flat)
+      {
+         break;
+      }
       handle = IntMapGetVal(handle->u1.successors, vec->array[i]);
       if(!handle)
       {
@@ -475,7 +734,18 @@ bool FVIndexDelete(FVIAnchor_p index, Clause_p clause)
    }
    FreqVectorFree(vec);
    /* ClauseDelProp(clause, CPIsSIndexed); */
-   res = handle?PTreeDeleteEntry(&(handle->u1.clauses), clause):false;
+   if(!handle)
+   {
+      res = false;
+   }
+   else if(handle->flat)
+   {
+      res = fv_leaf_delete(handle->u1.leaf, clause);
+   }
+   else
+   {
+      res = PTreeDeleteEntry(&(handle->u1.clauses), clause);
+   }
    PERF_CTR_EXIT(FVIndexTimer);
    return res;
 }
@@ -509,6 +779,14 @@ long FVIndexCountNodes(FVIndex_p index, bool leaves, bool empty)
     }
     assert(EQUIV(index->clause_count,index->u1.clauses));
       }
+      else if(index->flat)
+      {
+         if(!empty || !index->u1.leaf->size)
+         {
+            res++;
+         }
+         assert(index->clause_count == index->u1.leaf->size);
+      }
       else
       {
     if(!(empty||leaves))
@@ -21,6 +21,8 @@ Changes
     New
 <2> Sun Feb  6 02:16:41 CET 2005 (actually 2 weeks or so earlier)
     Switched to IntMap
+<3> Mon Oct 19 05:03:45 CEST 2026
+    Flat leaves for small subtrees
 
 -----------------------------------------------------------------------*/
 
@@ -28,6 +30,7 @@ Changes
 
 #define CCL_FCVINDEXING
 
+#include <stdint.h>
 #include <ccl_freqvectors.h>
 #include <clb_intmap.h>
 
@@ -50,14 +53,33 @@ typedef struct fvindex_parms_cell
 
 
 
+/* Small subtrees are stored flat: The remaining features of all
+   clauses below the node are kept in one contiguous array, one row
+   per clause. Candidates are then filtered by a linear scan over
+   this array, which the compiler can vectorize, instead of by
+   walking the trie one feature at a time. */
+
+typedef int32_t FVFeature;
+
+typedef struct fv_leaf_cell
+{
+   long      size;      /* Number of clauses (rows) */
+   long      alloc;     /* Number of rows allocated */
+   long      width;     /* Features per row */
+   FVFeature *features; /* size*width features, row by row */
+   Clause_p  *clauses;  /* Clause of each row */
+}FVLeafCell, *FVLeaf_p;
+
 typedef struct fv_index_cell
 {
    bool     final;
+   bool     flat;
    long     clause_count;
    union
    {
       IntMap_p successors;
       PTree_p  clauses;
+      FVLeaf_p leaf;
    }u1;
 }FVIndexCell, *FVIndex_p;
 
@@ -83,8 +105,31 @@ void           FVIndexParmsInit(FVIndexParms_p parms);
 FVIndexParms_p FVIndexParmsAlloc(void);
 #define FVIndexParmsFree(junk) FVIndexParmsCellFree(junk)
 
-#define FVIndexCellAlloc()    (FVIndexCell*)SizeMalloc(sizeof(FVIndexCell))
-#define FVIndexCellFree(junk) SizeFree(junk, sizeof(FVIndexCell))
+#define FVIndexCellAlloc()    (FVIndexCell*)SizeMallocClass(sizeof(FVIndexCell), \
+                                                          MemClassFVIndex)
+#define FVIndexCellFree(junk) SizeFreeClass(junk, sizeof(FVIndexCell), \
+                                            MemClassFVIndex)
+
+#define FVLeafCellAlloc()    (FVLeafCell*)SizeMallocClass(sizeof(FVLeafCell), \
+                                                        MemClassFVIndex)
+#define FVLeafCellFree(junk) SizeFreeClass(junk, sizeof(FVLeafCell), \
+                                           MemClassFVIndex)
+
+/* Maximal number of clauses in a flat leaf before it is split */
+#define FVINDEX_LEAF_MAX   32
+/* Subtrees with longer remaining vectors are never stored flat */
+#define FVINDEX_LEAF_WIDTH 64
+
+#define FVLeafRow(leaf, i) ((leaf)->features+(i)*(leaf)->width)
+
+static __inline__ void FVLeafPackQuery(FVFeature *dest, FreqVector_p vec,
+                                       long feature);
+static __inline__ bool FVLeafRowLessEq(FVFeature *row, FVFeature *query,
+                                       long width);
+static __inline__ bool FVLeafRowGreaterEq(FVFeature *row, FVFeature *query,
+                                          long width);
+static __inline__ bool FVLeafRowEqual(FVFeature *row, FVFeature *query,
+                                      long width);
 
 FVIndex_p FVIndexAlloc(void);
 void      FVIndexFree(FVIndex_p junk);
@@ -113,6 +158,119 @@ long        FVIndexCountNodes(FVIndex_p index, bool leaves, bool empty);
 FVPackedClause_p FVIndexPackClause(Clause_p clause, FVIAnchor_p anchor);
 
 void        FVIndexPrint(FILE* out, FVIndex_p index, bool fullterms);
+
+
+/*---------------------------------------------------------------------*/
+/*                  Implementations as inline functions                */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: FVLeafPackQuery()
+//
+//   Store the features of vec starting at feature in the format of
+//   flat leaf rows. Values that do not fit are clipped, which can
+//   only let additional candidates pass the filter.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void FVLeafPackQuery(FVFeature *dest, FreqVector_p vec,
+                                       long feature)
+{
+   long i;
+
+   for(i=feature; i<vec->size; i++)
+   {
+      *dest++ = (FVFeature)MIN(vec->array[i], INT32_MAX);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FVLeafRowLessEq()
+//
+//   Return true if no feature in row is larger than the corresponding
+//   feature in query (i.e. the row clause may subsume the query
+//   clause). The loop has no early exit, so that it vectorizes.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ bool FVLeafRowLessEq(FVFeature *row, FVFeature *query,
+                                       long width)
+{
+   int  res = 0;
+   long i;
+
+   for(i=0; i<width; i++)
+   {
+      res |= row[i] > query[i];
+   }
+   return !res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FVLeafRowGreaterEq()
+//
+//   Return true if no feature in row is smaller than the
+//   corresponding feature in query (i.e. the row clause may be
+//   subsumed by the query clause).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ bool FVLeafRowGreaterEq(FVFeature *row, FVFeature *query,
+                                          long width)
+{
+   int  res = 0;
+   long i;
+
+   for(i=0; i<width; i++)
+   {
+      res |= row[i] < query[i];
+   }
+   return !res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FVLeafRowEqual()
+//
+//   Return true if row and query agree on all features.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ bool FVLeafRowEqual(FVFeature *row, FVFeature *query,
+                                      long width)
+{
+   int  res = 0;
+   long i;
+
+   for(i=0; i<width; i++)
+   {
+      res |= row[i] != query[i];
+   }
+   return !res;
+}
+
 #endif
 
 /*---------------------------------------------------------------------*/
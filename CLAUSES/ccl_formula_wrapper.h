@@ -88,6 +88,8 @@ void       WFormulaFree(WFormula_p form);
 WFormula_p WFormulaFlatCopy(WFormula_p form);
 
 void       WFormulaGCMarkCells(WFormula_p form);
+#define    WFormulaGCMarkYoungCells(form)                      \
+   TBGCMarkYoungTerm((form)->terms, (form)->tformula)
 void       WFormulaMarkPolarity(WFormula_p form);
 
 char*      WFormulaGetId(WFormula_p form);
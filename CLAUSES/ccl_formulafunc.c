@@ -594,6 +594,7 @@ long FormulaSetCNF(FormulaSet_p set, FormulaSet_p archive,
 
    while(!FormulaSetEmpty(set))
    {
+      MemStatsPoll();
       handle = FormulaSetExtractFirst(set);
       // WFormulaPrint(stdout, handle, true);
       // fprintf(stdout, "\n");
@@ -648,6 +649,7 @@ long FormulaSetCNF2(FormulaSet_p set, FormulaSet_p archive,
 
    while(!FormulaSetEmpty(set))
    {
+      MemStatsPoll();
       handle = FormulaSetExtractFirst(set);
       //WFormulaPrint(stdout, handle, true);
       //fprintf(stdout, "\n");
@@ -727,6 +729,7 @@ long FormulaAndClauseSetParse(Scanner_p in, FormulaSet_p fset,
    default:
          while(TestInpId(in, "input_formula|input_clause|fof|cnf|tff|thf|tcf|include"))
          {
+            MemStatsPoll();
             if(TestInpId(in, "include"))
             {
                if(app_encode)
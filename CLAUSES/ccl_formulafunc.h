@@ -28,6 +28,7 @@ Changes
 
 #include <ccl_garbage_coll.h>
 #include <ccl_tcnf.h>
+#include <cio_signals.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -67,6 +67,7 @@ FormulaSet_p FormulaSetAlloc(void)
    set->anchor->succ = set->anchor;
    set->anchor->pred = set->anchor;
    set->identifier = DStrAlloc();
+   set->gc_cursor  = NULL;
 
    return set;
 }
@@ -220,6 +221,11 @@ void FormulaSetInsert(FormulaSet_p set, WFormula_p newform)
    set->anchor->pred = newform;
    newform->set = set;
    set->members++;
+   if(UNLIKELY(set->gc_cursor))
+   {
+      /* The set may already have been marked */
+      WFormulaGCMarkYoungCells(newform);
+   }
 }
 
 
@@ -269,6 +275,10 @@ WFormula_p FormulaSetExtractEntry(WFormula_p form)
    assert(form);
    assert(form->set);
 
+   if(UNLIKELY(form->set->gc_cursor == form))
+   {
+      form->set->gc_cursor = form->succ;
+   }
    form->pred->succ = form->succ;
    form->succ->pred = form->pred;
    form->set->members--;
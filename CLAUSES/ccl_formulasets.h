@@ -37,6 +37,9 @@ typedef struct formula_set_cell
    WFormula_p anchor;
    long       members;
    DStr_p     identifier;
+   WFormula_p gc_cursor; /* Next formula to be marked by the running
+                            young term collection, NULL if the set
+                            does not take part in one */
 }FormulaSetCell, *FormulaSet_p;
 
 
@@ -29,6 +29,9 @@ Changes
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+PERF_CTR_DEFINE(GCTimer);
+PERF_CTR_DEFINE(GCYoungTimer);
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -39,6 +42,147 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: gc_young_start()
+//
+//   Start an incremental young collection of gc->bank. All registered
+//   sets take part in it: Their cursors are set to their first
+//   element, and clauses or formulas inserted from now on are marked
+//   right away.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, marks terms
+//
+/----------------------------------------------------------------------*/
+
+static void gc_young_start(GCAdmin_p gc)
+{
+   PTree_p entry;
+   PStack_p trav;
+   ClauseSet_p cset;
+   FormulaSet_p fset;
+
+   assert(!GCYoungRunning(gc));
+
+   TBGCYoungStart(gc->bank);
+   gc->young_clause_sets  = PStackAlloc();
+   gc->young_formula_sets = PStackAlloc();
+   gc->young_pos          = 0;
+
+   trav = PTreeTraverseInit(gc->clause_sets);
+   while((entry = PTreeTraverseNext(trav)))
+   {
+      cset = entry->key;
+      cset->gc_cursor = cset->anchor->succ;
+      PStackPushP(gc->young_clause_sets, cset);
+   }
+   PTreeTraverseExit(trav);
+
+   trav = PTreeTraverseInit(gc->formula_sets);
+   while((entry = PTreeTraverseNext(trav)))
+   {
+      fset = entry->key;
+      fset->gc_cursor = fset->anchor->succ;
+      PStackPushP(gc->young_formula_sets, fset);
+   }
+   PTreeTraverseExit(trav);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gc_young_mark_step()
+//
+//   Mark the young terms of up to budget clauses or formulas of the
+//   sets taking part in the running collection. Returns the unused
+//   budget, which is positive only if marking is complete.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks terms
+//
+/----------------------------------------------------------------------*/
+
+static long gc_young_mark_step(GCAdmin_p gc, long budget)
+{
+   PStackPointer clause_sets = PStackGetSP(gc->young_clause_sets);
+   ClauseSet_p   cset;
+   FormulaSet_p  fset;
+
+   while(budget && gc->young_pos < clause_sets)
+   {
+      cset = PStackElementP(gc->young_clause_sets, gc->young_pos);
+      if(cset->gc_cursor == cset->anchor)
+      {
+         gc->young_pos++;
+         continue;
+      }
+      ClauseGCMarkYoungTerms(cset->gc_cursor);
+      cset->gc_cursor = cset->gc_cursor->succ;
+      budget--;
+   }
+   while(budget && gc->young_pos-clause_sets <
+         PStackGetSP(gc->young_formula_sets))
+   {
+      fset = PStackElementP(gc->young_formula_sets,
+                            gc->young_pos-clause_sets);
+      if(fset->gc_cursor == fset->anchor)
+      {
+         gc->young_pos++;
+         continue;
+      }
+      WFormulaGCMarkYoungCells(fset->gc_cursor);
+      fset->gc_cursor = fset->gc_cursor->succ;
+      budget--;
+   }
+   return budget;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gc_young_stop()
+//
+//   End the running young collection (whether it is complete or
+//   not). If touch_sets is false, the sets may already be gone and
+//   are left alone.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void gc_young_stop(GCAdmin_p gc, bool touch_sets)
+{
+   PStackPointer i;
+   ClauseSet_p   cset;
+   FormulaSet_p  fset;
+
+   assert(GCYoungRunning(gc));
+
+   if(touch_sets)
+   {
+      for(i=0; i<PStackGetSP(gc->young_clause_sets); i++)
+      {
+         cset = PStackElementP(gc->young_clause_sets, i);
+         cset->gc_cursor = NULL;
+      }
+      for(i=0; i<PStackGetSP(gc->young_formula_sets); i++)
+      {
+         fset = PStackElementP(gc->young_formula_sets, i);
+         fset->gc_cursor = NULL;
+      }
+   }
+   PStackFree(gc->young_clause_sets);
+   PStackFree(gc->young_formula_sets);
+   gc->young_clause_sets  = NULL;
+   gc->young_formula_sets = NULL;
+   TBGCYoungStop(gc->bank);
+}
+
 
 
 /*---------------------------------------------------------------------*/
@@ -66,6 +210,9 @@ GCAdmin_p GCAdminAlloc(TB_p bank)
    handle->bank         = bank;
    handle->clause_sets  = NULL;
    handle->formula_sets = NULL;
+   handle->young_clause_sets  = NULL;
+   handle->young_formula_sets = NULL;
+   handle->young_pos    = 0;
    bank->gc             = handle;
 
    return handle;
@@ -88,6 +235,10 @@ void GCAdminFree(GCAdmin_p junk)
 {
    assert(junk);
 
+   if(GCYoungRunning(junk))
+   {
+      gc_young_stop(junk, false);
+   }
    PTreeFree(junk->clause_sets);
    PTreeFree(junk->formula_sets);
 
@@ -111,6 +262,10 @@ void GCRegisterFormulaSet(GCAdmin_p gc, FormulaSet_p set)
 {
    assert(gc);
    assert(set);
+   if(GCYoungRunning(gc))
+   {
+      gc_young_stop(gc, true);
+   }
    PTreeStore(&(gc->formula_sets), set);
 }
 
@@ -131,6 +286,10 @@ void GCRegisterClauseSet(GCAdmin_p gc, ClauseSet_p set)
 {
    assert(gc);
    assert(set);
+   if(GCYoungRunning(gc))
+   {
+      gc_young_stop(gc, true);
+   }
    PTreeStore(&(gc->clause_sets), set);
 }
 
@@ -151,6 +310,10 @@ void GCDeregisterFormulaSet(GCAdmin_p gc, FormulaSet_p set)
 {
    assert(gc);
    assert(set);
+   if(GCYoungRunning(gc))
+   {
+      gc_young_stop(gc, true);
+   }
    PTreeDeleteEntry(&(gc->formula_sets), set);
 }
 
@@ -170,6 +333,10 @@ void GCDeregisterClauseSet(GCAdmin_p gc, ClauseSet_p set)
 {
    assert(gc);
    assert(set);
+   if(GCYoungRunning(gc))
+   {
+      gc_young_stop(gc, true);
+   }
    PTreeDeleteEntry(&(gc->clause_sets), set);
 }
 
@@ -177,7 +344,8 @@ void GCDeregisterClauseSet(GCAdmin_p gc, ClauseSet_p set)
 //
 // Function: GCCollect()
 //
-//   Perform garbage collection on gc->bank.
+//   Perform garbage collection on gc->bank. A running incremental
+//   collection is abandoned.
 //
 // Global Variables: -
 //
@@ -189,10 +357,16 @@ long GCCollect(GCAdmin_p gc)
 {
    PTree_p entry;
    PStack_p trav;
+   long res;
 
    assert(gc);
    assert(gc->bank);
 
+   if(GCYoungRunning(gc))
+   {
+      gc_young_stop(gc, true);
+   }
+   PERF_CTR_ENTRY(GCTimer);
    trav = PTreeTraverseInit(gc->clause_sets);
    while((entry = PTreeTraverseNext(trav)))
    {
@@ -207,7 +381,73 @@ long GCCollect(GCAdmin_p gc)
    }
    PTreeTraverseExit(trav);
 
-   return TBGCSweep(gc->bank);
+   res = TBGCSweep(gc->bank);
+   PERF_CTR_EXIT(GCTimer);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GCCollectIncremental()
+//
+//   Collect the young generation of gc->bank (the cells created since
+//   the last collection, see TBGCStartGenerations()) in bounded
+//   steps, to be called regularly from the main loop. Every call does
+//   at most GC_STEP_SIZE units of work. A collection is started once
+//   the young generation has grown to GC_YOUNG_LIMIT cells. Marking
+//   starts from the remembered rewrite links, then visits the
+//   registered sets one clause or formula at a time, but does not
+//   descend into old cells. The barriers in the bank and in the sets
+//   keep everything that becomes reachable in between steps
+//   alive. The sweep then only visits the young generation. Old
+//   garbage survives until the next GCCollect(). Returns the number
+//   of term cells recovered. With higher-order support, the binding
+//   caches of applied variables may point from old to young cells,
+//   so this is a no-op.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long GCCollectIncremental(GCAdmin_p gc)
+{
+   long res = 0;
+#ifndef ENABLE_LFHO
+   long budget = GC_STEP_SIZE;
+
+   if(!gc->bank->gc_young)
+   {
+      TBGCStartGenerations(gc->bank);
+   }
+   if(!GCYoungRunning(gc))
+   {
+      if(TBGCYoungSize(gc->bank) < GC_YOUNG_LIMIT)
+      {
+         return 0;
+      }
+      gc_young_start(gc);
+   }
+   PERF_CTR_ENTRY(GCYoungTimer);
+   budget = TBGCYoungMarkRWStep(gc->bank, budget);
+   if(budget)
+   {
+      budget = gc_young_mark_step(gc, budget);
+   }
+   if(budget)
+   {
+      res = TBGCYoungSweepStep(gc->bank, budget);
+      if(TBGCYoungSweepDone(gc->bank))
+      {
+         gc_young_stop(gc, true);
+      }
+   }
+   PERF_CTR_EXIT(GCYoungTimer);
+#endif
+   return res;
 }
 
 
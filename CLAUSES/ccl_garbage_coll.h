@@ -42,6 +42,10 @@ typedef struct gc_admin_cell
    TB_p    bank;
    PTree_p clause_sets;
    PTree_p formula_sets;
+   PStack_p young_clause_sets;  /* Sets taking part in the running */
+   PStack_p young_formula_sets; /* young collection, NULL if none */
+   PStackPointer young_pos;     /* Next set to be marked, clause
+                                   sets first */
 }GCAdminCell, *GCAdmin_p;
 
 
@@ -49,6 +53,15 @@ typedef struct gc_admin_cell
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+/* Size of the young generation (in term cells) that triggers an
+   incremental collection, and the work (clauses or formulas marked,
+   term cells swept) done per call of GCCollectIncremental() */
+#define GC_YOUNG_LIMIT 262144
+#define GC_STEP_SIZE   4096
+
+PERF_CTR_DECL(GCTimer);
+PERF_CTR_DECL(GCYoungTimer);
+
 #define GCAdminCellAlloc()    (GCAdminCell*)SizeMalloc(sizeof(GCAdminCell))
 #define GCAdminCellFree(junk) SizeFree(junk, sizeof(GCAdminCell))
 
@@ -59,7 +72,10 @@ void      GCRegisterClauseSet(GCAdmin_p gc, ClauseSet_p set);
 void      GCDeregisterFormulaSet(GCAdmin_p gc, FormulaSet_p set);
 void      GCDeregisterClauseSet(GCAdmin_p gc, ClauseSet_p set);
 
+#define   GCYoungRunning(gc) ((gc)->young_clause_sets!=NULL)
+
 long      GCCollect(GCAdmin_p gc);
+long      GCCollectIncremental(GCAdmin_p gc);
 
 #endif
 
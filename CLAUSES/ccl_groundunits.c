@@ -0,0 +1,344 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_groundunits.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Hash index for ground unit clauses.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 05:33:17 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "ccl_groundunits.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Fibonacci hashing multiplier */
+#define GU_HASH_MULT 0x9E3779B97F4A7C15ULL
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: gu_hash()
+//
+//   Return the bucket for the term pair t1, t2 with the given sign.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ long gu_hash(GroundUnitIndex_p index, Term_p t1,
+                               Term_p t2, bool positive)
+{
+   uint64_t hash = ((uintptr_t)t1>>3)*GU_HASH_MULT;
+
+   hash = (hash^((uintptr_t)t2>>3)^positive)*GU_HASH_MULT;
+   return (long)(hash>>(64-index->bits));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gu_resize()
+//
+//   Rehash all entries into a table with 2^bits buckets.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes index
+//
+/----------------------------------------------------------------------*/
+
+static void gu_resize(GroundUnitIndex_p index, int bits)
+{
+   GroundUnit_p *old_buckets = index->buckets;
+   long         old_size = GroundUnitIndexSize(index), i, hash;
+   GroundUnit_p cell, next;
+
+   index->bits    = bits;
+   index->buckets = SizeMallocClass(GroundUnitIndexSize(index)*
+                                    sizeof(GroundUnit_p),
+                                    MemClassGroundUnits);
+   for(i=0; i<GroundUnitIndexSize(index); i++)
+   {
+      index->buckets[i] = NULL;
+   }
+   for(i=0; i<old_size; i++)
+   {
+      for(cell = old_buckets[i]; cell; cell = next)
+      {
+         next = cell->next;
+         hash = gu_hash(index, cell->lside, cell->rside,
+                        EqnIsPositive(cell->pos->literal));
+         cell->next = index->buckets[hash];
+         index->buckets[hash] = cell;
+      }
+   }
+   SizeFreeClass(old_buckets, old_size*sizeof(GroundUnit_p),
+                 MemClassGroundUnits);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gu_add()
+//
+//   Add the unit clause under the key (side of the literal, other
+//   side).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes index
+//
+/----------------------------------------------------------------------*/
+
+static void gu_add(GroundUnitIndex_p index, Clause_p clause, EqnSide side)
+{
+   GroundUnit_p cell = GroundUnitCellAlloc();
+   Eqn_p        lit = clause->literals;
+   long         hash;
+
+   if(index->entries >= GroundUnitIndexSize(index))
+   {
+      gu_resize(index, index->bits+1);
+   }
+   cell->pos          = ClausePosCellAlloc();
+   cell->pos->clause  = clause;
+   cell->pos->literal = lit;
+   cell->pos->side    = side;
+   cell->pos->pos     = NULL;
+   cell->lside = (side == LeftSide)? lit->lterm : lit->rterm;
+   cell->rside = (side == LeftSide)? lit->rterm : lit->lterm;
+
+   hash = gu_hash(index, cell->lside, cell->rside, EqnIsPositive(lit));
+   cell->next = index->buckets[hash];
+   index->buckets[hash] = cell;
+   index->entries++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gu_remove()
+//
+//   Remove the entry of clause under the key (side, other side).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes index
+//
+/----------------------------------------------------------------------*/
+
+static void gu_remove(GroundUnitIndex_p index, Clause_p clause, EqnSide side)
+{
+   Eqn_p        lit = clause->literals;
+   Term_p       t1 = (side == LeftSide)? lit->lterm : lit->rterm;
+   Term_p       t2 = (side == LeftSide)? lit->rterm : lit->lterm;
+   GroundUnit_p *ref, cell;
+
+   ref = &(index->buckets[gu_hash(index, t1, t2, EqnIsPositive(lit))]);
+   while((cell = *ref) && cell->pos->clause != clause)
+   {
+      ref = &(cell->next);
+   }
+   assert(cell);
+   assert(cell->lside == t1 && cell->rside == t2);
+   *ref = cell->next;
+   ClausePosCellFree(cell->pos);
+   GroundUnitCellFree(cell);
+   index->entries--;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundUnitIndexAlloc()
+//
+//   Allocate an empty ground unit index.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+GroundUnitIndex_p GroundUnitIndexAlloc(void)
+{
+   GroundUnitIndex_p handle = GroundUnitIndexCellAlloc();
+   long i;
+
+   handle->entries   = 0;
+   handle->nonground = 0;
+   handle->bits      = GROUND_UNIT_INIT_BITS;
+   handle->buckets   = SizeMallocClass(GroundUnitIndexSize(handle)*
+                                       sizeof(GroundUnit_p),
+                                       MemClassGroundUnits);
+   for(i=0; i<GroundUnitIndexSize(handle); i++)
+   {
+      handle->buckets[i] = NULL;
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundUnitIndexFree()
+//
+//   Free a ground unit index (but not the indexed clauses).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void GroundUnitIndexFree(GroundUnitIndex_p junk)
+{
+   long         i;
+   GroundUnit_p cell, next;
+
+   for(i=0; i<GroundUnitIndexSize(junk); i++)
+   {
+      for(cell = junk->buckets[i]; cell; cell = next)
+      {
+         next = cell->next;
+         ClausePosCellFree(cell->pos);
+         GroundUnitCellFree(cell);
+      }
+   }
+   SizeFreeClass(junk->buckets, GroundUnitIndexSize(junk)*sizeof(GroundUnit_p),
+                 MemClassGroundUnits);
+   GroundUnitIndexCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundUnitIndexInsert()
+//
+//   Register a unit clause that is inserted into the demodulator
+//   index of a set. Ground units are added, others are only
+//   counted.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes index
+//
+/----------------------------------------------------------------------*/
+
+void GroundUnitIndexInsert(GroundUnitIndex_p index, Clause_p clause)
+{
+   assert(ClauseIsUnit(clause));
+
+   if(!ClauseIsGround(clause))
+   {
+      index->nonground++;
+      return;
+   }
+   gu_add(index, clause, LeftSide);
+   if(!EqnIsOriented(clause->literals))
+   {
+      gu_add(index, clause, RightSide);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundUnitIndexDelete()
+//
+//   Undo GroundUnitIndexInsert() for clause, which has to be
+//   unchanged since then.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes index
+//
+/----------------------------------------------------------------------*/
+
+void GroundUnitIndexDelete(GroundUnitIndex_p index, Clause_p clause)
+{
+   assert(ClauseIsUnit(clause));
+
+   if(!ClauseIsGround(clause))
+   {
+      assert(index->nonground > 0);
+      index->nonground--;
+      return;
+   }
+   gu_remove(index, clause, LeftSide);
+   if(!EqnIsOriented(clause->literals))
+   {
+      gu_remove(index, clause, RightSide);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundUnitIndexFind()
+//
+//   Return the position of a ground unit t1=t2 (if positive) or
+//   t1!=t2 (otherwise) in the index, NULL if there is none. t1 and t2
+//   have to be shared terms.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+ClausePos_p GroundUnitIndexFind(GroundUnitIndex_p index, Term_p t1,
+                                Term_p t2, bool positive)
+{
+   GroundUnit_p cell;
+
+   for(cell = index->buckets[gu_hash(index, t1, t2, positive)];
+       cell;
+       cell = cell->next)
+   {
+      if(cell->lside == t1 && cell->rside == t2 &&
+         EQUIV(EqnIsPositive(cell->pos->literal), positive))
+      {
+         return cell->pos;
+      }
+   }
+   return NULL;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
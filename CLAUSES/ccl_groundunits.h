@@ -0,0 +1,94 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_groundunits.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Hash index for ground unit clauses. It is keyed by the (shared)
+  terms of both sides of the literal and its sign, and finds a
+  ground unit s=t or s!=t for a given term pair in constant time.
+  Unoriented units are stored under both orientations, oriented ones
+  only as lside=rside (mirroring what the demodulator index does).
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 05:33:17 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_GROUNDUNITS
+
+#define CCL_GROUNDUNITS
+
+#include <ccl_clausepos.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define GROUND_UNIT_INIT_BITS 6  /* Initial size is 2^this */
+
+typedef struct ground_unit_cell
+{
+   Term_p                  lside;  /* Side the unit is found by */
+   Term_p                  rside;
+   ClausePos_p             pos;
+   struct ground_unit_cell *next;
+}GroundUnitCell, *GroundUnit_p;
+
+typedef struct ground_unit_index_cell
+{
+   long         entries;
+   long         nonground; /* Units of the set that are not in here */
+   int          bits;      /* Number of buckets is 2^bits */
+   GroundUnit_p *buckets;
+}GroundUnitIndexCell, *GroundUnitIndex_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define GroundUnitCellAlloc()    (GroundUnitCell*) \
+        SizeMallocClass(sizeof(GroundUnitCell), MemClassGroundUnits)
+#define GroundUnitCellFree(junk) \
+        SizeFreeClass(junk, sizeof(GroundUnitCell), MemClassGroundUnits)
+#define GroundUnitIndexCellAlloc() (GroundUnitIndexCell*) \
+        SizeMallocClass(sizeof(GroundUnitIndexCell), MemClassGroundUnits)
+#define GroundUnitIndexCellFree(junk) \
+        SizeFreeClass(junk, sizeof(GroundUnitIndexCell), MemClassGroundUnits)
+
+#define GroundUnitIndexSize(index) (1L<<(index)->bits)
+#define GroundUnitIndexStorage(index) \
+   ((index)?(GroundUnitIndexSize(index)*(long)sizeof(GroundUnit_p)+\
+             (index)->entries*(long)(sizeof(GroundUnitCell)+\
+                                     sizeof(ClausePosCell))):0)
+
+/* True if all units of the set are in the index, i.e. if in
+   first-order problems a unit matching a term pair has to be found
+   here. */
+#define GroundUnitIndexComplete(index) ((index)->nonground == 0)
+
+GroundUnitIndex_p GroundUnitIndexAlloc(void);
+void              GroundUnitIndexFree(GroundUnitIndex_p junk);
+
+void        GroundUnitIndexInsert(GroundUnitIndex_p index, Clause_p clause);
+void        GroundUnitIndexDelete(GroundUnitIndex_p index, Clause_p clause);
+ClausePos_p GroundUnitIndexFind(GroundUnitIndex_p index, Term_p t1,
+                                Term_p t2, bool positive);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
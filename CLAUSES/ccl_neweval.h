@@ -80,8 +80,10 @@ typedef struct eval_cell
 extern long EvaluationCounter;
 
 #define EVAL_SIZE(eval_no) (sizeof(EvalCell)+((eval_no)*sizeof(SimpleEvalCell)))
-#define EvalCellAlloc(eval_no)   (EvalCell*)SizeMalloc(EVAL_SIZE(eval_no))
-#define EvalCellFree(junk, eval_no) SizeFree(junk, EVAL_SIZE(eval_no))
+#define EvalCellAlloc(eval_no)   (EvalCell*)SizeMallocClass(EVAL_SIZE(eval_no), \
+                                                           MemClassEval)
+#define EvalCellFree(junk, eval_no) SizeFreeClass(junk, EVAL_SIZE(eval_no), \
+                                                  MemClassEval)
 
 #ifdef CONSTANT_MEM_ESTIMATE
 #define EVAL_MEM(eval_no) (32+(4*(eval_no)))
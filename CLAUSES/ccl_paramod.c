@@ -35,6 +35,19 @@ Changes
 bool ParamodOverlapNonEqLiterals = true;
 bool ParamodOverlapIntoNegativeLiterals = true;
 
+/* Names of the ParamodulationType values (e.g. for auto-mode
+   tables) */
+
+char* ParamodTypeNames[] =
+{
+   "Plain",
+   "AlwaysSim",
+   "OrientedSim",
+   "DecreasingSim",
+   "SizeDecreasingSim",
+   NULL
+};
+
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
@@ -67,6 +67,8 @@ typedef struct
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+extern char* ParamodTypeNames[];
+
 
 void     ParamodInfoPrint(FILE* out, ParamodInfo_p info);
 
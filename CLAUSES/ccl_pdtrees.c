@@ -1223,7 +1223,7 @@ long PDTreeDelete(PDTree_p tree, Term_p term, Clause_p clause)
 
    res = delete_clause_entries(&(node->entries), clause);
 
-   if(term->weight == node->size_constr)
+   if(TermCellWeight(term) == node->size_constr)
    {
       node->size_constr = -1;
    }
@@ -1252,7 +1252,7 @@ long PDTreeDelete(PDTree_p tree, Term_p term, Clause_p clause)
       }
       node = prev;
 
-      if(term->weight == node->size_constr)
+      if(TermCellWeight(term) == node->size_constr)
       {
          node->size_constr = -1;
       }
@@ -161,8 +161,10 @@ extern bool PDTreeUseSizeConstraints;
 #define PDTNodeGetSizeConstraint(node) ((node)->size_constr != -1 ? (node)->size_constr : pdt_compute_size_constraint((node)))
 #define PDTNodeGetAgeConstraint(node) (!SysDateIsInvalid((node)->age_constr))? (node)->age_constr: pdt_compute_age_constraint((node))
 
-#define   PDTNodeCellAlloc()    (PDTNodeCell*)SizeMalloc(sizeof(PDTNodeCell))
-#define   PDTNodeCellFree(junk) SizeFree(junk, sizeof(PDTNodeCell))
+#define   PDTNodeCellAlloc()    (PDTNodeCell*)SizeMallocClass(sizeof(PDTNodeCell), \
+                                                              MemClassPDT)
+#define   PDTNodeCellFree(junk) SizeFreeClass(junk, sizeof(PDTNodeCell), \
+                                              MemClassPDT)
 PDTNode_p PDTNodeAlloc(void);
 void      PDTNodeFree(PDTNode_p tree);
 
@@ -78,6 +78,33 @@ static void clause_set_analyse_gc(ClauseSet_p set, unsigned long *clause_count,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: clause_set_push_deriv_refs()
+//
+//   Push the addresses of the derivation references of all clauses
+//   in set onto refs.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void clause_set_push_deriv_refs(ClauseSet_p set, PStack_p refs)
+{
+   Clause_p handle;
+
+   for(handle = set->anchor->succ; handle != set->anchor; handle = handle->succ)
+   {
+      if(handle->derivation)
+      {
+         PStackPushP(refs, &(handle->derivation));
+      }
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: clause_set_pick_training_examples()
@@ -452,6 +479,50 @@ void ProofStateFree(ProofState_p junk)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ProofStateCompactDerivLog()
+//
+//   Compact the global derivation log. All clauses with a derivation
+//   have to be in one of the clause sets of state (the same
+//   invariant the term garbage collector relies on), so this should
+//   only be called between main loop iterations. Returns the number
+//   of bytes reclaimed.
+//
+// Global Variables: DerivLog
+//
+// Side Effects    : Changes the derivation references of all clauses
+//
+/----------------------------------------------------------------------*/
+
+long ProofStateCompactDerivLog(ProofState_p state)
+{
+   PStack_p refs = PStackAlloc();
+   long     res;
+
+   clause_set_push_deriv_refs(state->axioms, refs);
+   clause_set_push_deriv_refs(state->ax_archive, refs);
+   clause_set_push_deriv_refs(state->processed_pos_rules, refs);
+   clause_set_push_deriv_refs(state->processed_pos_eqns, refs);
+   clause_set_push_deriv_refs(state->processed_neg_units, refs);
+   clause_set_push_deriv_refs(state->processed_non_units, refs);
+   clause_set_push_deriv_refs(state->unprocessed, refs);
+   clause_set_push_deriv_refs(state->tmp_store, refs);
+   clause_set_push_deriv_refs(state->eval_store, refs);
+   clause_set_push_deriv_refs(state->archive, refs);
+   if(state->watchlist)
+   {
+      clause_set_push_deriv_refs(state->watchlist, refs);
+   }
+   clause_set_push_deriv_refs(state->definition_store->def_clauses, refs);
+
+   res = DerivLogCompact(refs);
+   PStackFree(refs);
+
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ProofStateIsUntyped()
@@ -713,6 +784,9 @@ void ProofStateStatisticsPrint(FILE* out, ProofState_p state)
               "# Match attempts with unoriented units : %lu\n",
               state->processed_pos_rules->demod_index->match_count,
               state->processed_pos_eqns->demod_index->match_count);
+      fprintf(out,
+              "# Derivation log bytes (used/garbage)  : %ld/%ld\n",
+              DerivLogUsed(), DerivLogGarbage());
 #ifdef MEASURE_EXPENSIVE
       fprintf(out,
               "# Oriented PDT nodes visited           : %lu\n"
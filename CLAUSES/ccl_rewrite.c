@@ -185,6 +185,7 @@ static RWResultType term_is_top_rewritable(TB_p bank, OCB_p ocb,
             }
 
             TermAddRWLink(term, rterm, new_demod, ClauseIsSOS(new_demod), res);
+            TBGCNoteRWLink(bank, term);
          }
       }
       SubstBacktrack(subst);
@@ -215,6 +216,7 @@ static RWResultType term_is_top_rewritable(TB_p bank, OCB_p ocb,
             }
 
             TermAddRWLink(term, rterm, new_demod, ClauseIsSOS(new_demod), res);
+            TBGCNoteRWLink(bank, term);
          }
       }
    }
@@ -272,7 +274,7 @@ static bool term_is_rewritable(TB_p bank, OCB_p ocb, Term_p term, Clause_p
 
    /* assert(!TermIsRewritten(term));*/
 
-   if(SysDateEqual(term->rw_data.nf_date[RewriteAdr(FullRewrite)], nf_date))
+   if(SysDateEqual(TermNFDate(term, RewriteAdr(FullRewrite)), nf_date))
    {
       return false;
    }
@@ -451,7 +453,7 @@ MatchRes_p indexed_find_demodulator(OCB_p ocb, Term_p term,
    assert(term);
    assert(demodulators);
    assert(demodulators->demod_index);
-   assert(term->weight == 
+   assert(TermCellWeight(term) ==
             TermWeight(term, DEFAULT_VWEIGHT, DEFAULT_FWEIGHT));
    assert(!TermIsTopRewritten(term));
 
@@ -582,6 +584,7 @@ static Term_p rewrite_with_clause_set(OCB_p ocb, TB_p bank, Term_p term,
       assert(mi->pos->clause->ident);    
       TermAddRWLink(term, repl, mi->pos->clause, ClauseIsSOS(mi->pos->clause),
                     restricted_rw?RWAlwaysRewritable:RWLimitedRewritable);
+      TBGCNoteRWLink(bank, term);
       term = repl;
       MatchResFree(mi);
    }
@@ -670,6 +673,7 @@ static bool term_subterm_rewrite(RWDesc_p desc, Term_p *term)
       assert(new_term!=*term);
       TermAddRWLink(*term, new_term, REWRITE_AT_SUBTERM, false,
                     RWAlwaysRewritable);
+      TBGCNoteRWLink(desc->bank, *term);
       *term = new_term;
    }
    else
@@ -761,6 +765,35 @@ static Term_p term_li_normalform(RWDesc_p desc, Term_p term,
    return term;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: clause_push_rw_derivation()
+//
+//   Record the rewrite steps transforming from into to in the
+//   derivation of clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, extends the derivation log
+//
+/----------------------------------------------------------------------*/
+
+static void clause_push_rw_derivation(Clause_p clause, Term_p from,
+                                      Term_p to)
+{
+   PStack_p demods = PStackAlloc();
+   PStackPointer i;
+
+   TermComputeRWSequence(demods, from, to, 0);
+   for(i=0; i<PStackGetSP(demods); i++)
+   {
+      ClausePushDerivation(clause, DCRewrite,
+                           PStackElementP(demods, i), NULL);
+   }
+   PStackFree(demods);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: eqn_li_normalform()
@@ -792,9 +825,8 @@ EqnSide eqn_li_normalform(RWDesc_p desc, ClausePos_p pos, bool interred_rw)
       {
          DocClauseRewriteDefault(pos, l_old);
       }
-      CLAUSE_ENSURE_DERIVATION(pos->clause);
-      TermComputeRWSequence(pos->clause->derivation,
-                            l_old, ClausePosGetSide(pos), DCRewrite);
+      clause_push_rw_derivation(pos->clause, l_old,
+                                ClausePosGetSide(pos));
    }
    eqn->rterm = term_li_normalform(desc, eqn->rterm, false);
    if(r_old!=eqn->rterm)
@@ -816,9 +848,8 @@ EqnSide eqn_li_normalform(RWDesc_p desc, ClausePos_p pos, bool interred_rw)
       {
          DocClauseRewriteDefault(pos, r_old);
       }
-      CLAUSE_ENSURE_DERIVATION(pos->clause);
-      TermComputeRWSequence(pos->clause->derivation,
-                            r_old, ClausePosGetSide(pos), DCRewrite);
+      clause_push_rw_derivation(pos->clause, r_old,
+                                ClausePosGetSide(pos));
    }
    return res;
 }
@@ -959,6 +990,7 @@ static long term_find_rw_clauses(Clause_p demod,
                TermTopFree(tmp_rewritten);
             }
             TermAddRWLink(term, rterm, demod, ClauseIsSOS(demod), rwres);
+            TBGCNoteRWLink(eqn->bank, term);
             //TermDeleteRWLink(term);
          }
       }
@@ -1198,7 +1230,7 @@ long ClauseSetComputeLINormalform(OCB_p ocb, TB_p bank, ClauseSet_p
 
       if(tmp)
       {
-         handle->weight = ClauseStandardWeight(handle);
+         ClauseUpdateSubsumeInfo(handle);
          res++;
       }
       /* assert(handle->weight == ClauseStandardWeight(handle)); */
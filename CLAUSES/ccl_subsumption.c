@@ -32,6 +32,7 @@ PERF_CTR_DEFINE(SubsumeTimer);
 
 bool StrongUnitForwardSubsumption     = false;
 long ClauseClauseSubsumptionCalls     = 0;
+long ClauseClauseSubsumptionSigFails  = 0;
 long ClauseClauseSubsumptionCallsRec  = 0;
 long ClauseClauseSubsumptionSuccesses = 0;
 long UnitClauseClauseSubsumptionCalls = 0;
@@ -659,6 +660,8 @@ static bool clause_subsumes_clause(Clause_p subsumer, Clause_p
 
    assert(sub_candidate->weight == ClauseStandardWeight(sub_candidate));
    assert(subsumer->weight == ClauseStandardWeight(subsumer));
+   assert(sub_candidate->lit_sig == ClauseLitSignature(sub_candidate));
+   assert(subsumer->lit_sig == ClauseLitSignature(subsumer));
 
    ClauseClauseSubsumptionCalls++;
 
@@ -673,6 +676,12 @@ static bool clause_subsumes_clause(Clause_p subsumer, Clause_p
       PERF_CTR_EXIT(SubsumeTimer);
       return false;
    }
+   if(!ClauseLitSigSubset(subsumer, sub_candidate))
+   {
+      ClauseClauseSubsumptionSigFails++;
+      PERF_CTR_EXIT(SubsumeTimer);
+      return false;
+   }
    if(((sub_candidate->pos_lit_no >=3) ||
        (sub_candidate->neg_lit_no >=3))&&
       !check_subsumption_possibility(subsumer, sub_candidate))
@@ -779,6 +788,40 @@ Clause_p clause_tree_find_subsuming_clause(PTree_p tree, Clause_p sub_candidate)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: clause_leaf_find_subsuming_clause()
+//
+//   Return a clause from the flat leaf that subsumes vec->clause (or
+//   NULL). feature is the position of the first feature stored in the
+//   leaf.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+Clause_p clause_leaf_find_subsuming_clause(FVLeaf_p leaf, FreqVector_p vec,
+                                           long feature)
+{
+   FVFeature query[FVINDEX_LEAF_WIDTH];
+   long      i;
+
+   FVLeafPackQuery(query, vec, feature);
+   for(i=0; i<leaf->size; i++)
+   {
+      if(FVLeafRowLessEq(FVLeafRow(leaf, i), query, leaf->width) &&
+         clause_subsumes_clause(leaf->clauses[i], vec->clause))
+      {
+         return leaf->clauses[i];
+      }
+   }
+   return NULL;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: clause_set_subsumes_clause_indexed()
@@ -804,6 +847,10 @@ Clause_p clause_set_subsumes_clause_indexed(FVIndex_p index,
    {
       return clause_tree_find_subsuming_clause(index->u1.clauses, vec->clause);
    }
+   else if(index->flat)
+   {
+      return clause_leaf_find_subsuming_clause(index->u1.leaf, vec, feature);
+   }
    else if(index->u1.successors)
    {
       long i;
@@ -976,6 +1023,45 @@ Clause_p clauseset_find_first_subsumed_clause(ClauseSet_p set,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: clause_leaf_find_subsumed_clauses()
+//
+//   Push all clauses from the flat leaf that are subsumed by
+//   vec->clause onto res. If res is NULL, return the first such
+//   clause instead. feature is the position of the first feature
+//   stored in the leaf.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+Clause_p clause_leaf_find_subsumed_clauses(FVLeaf_p leaf, FreqVector_p vec,
+                                           long feature, PStack_p res)
+{
+   FVFeature query[FVINDEX_LEAF_WIDTH];
+   long      i;
+
+   FVLeafPackQuery(query, vec, feature);
+   for(i=0; i<leaf->size; i++)
+   {
+      if(FVLeafRowGreaterEq(FVLeafRow(leaf, i), query, leaf->width) &&
+         clause_subsumes_clause(vec->clause, leaf->clauses[i]))
+      {
+         if(!res)
+         {
+            return leaf->clauses[i];
+         }
+         PStackPushP(res, leaf->clauses[i]);
+      }
+   }
+   return NULL;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: clauseset_find_subsumed_clauses_indexed()
@@ -999,6 +1085,10 @@ void clauseset_find_subsumed_clauses_indexed(FVIndex_p index,
    {
       clause_tree_find_subsumed_clauses(index->u1.clauses, vec->clause, res);
    }
+   else if(index->flat)
+   {
+      clause_leaf_find_subsumed_clauses(index->u1.leaf, vec, feature, res);
+   }
    else if(index->u1.successors)
    {
       long i;
@@ -1044,6 +1134,11 @@ Clause_p clauseset_find_first_subsumed_clause_indexed(FVIndex_p index,
    {
       res = clause_tree_find_first_subsumed_clause(index->u1.clauses, vec->clause);
    }
+   else if(index->flat)
+   {
+      res = clause_leaf_find_subsumed_clauses(index->u1.leaf, vec, feature,
+                                              NULL);
+   }
    else if(index->u1.successors)
    {
       long i;
@@ -1094,7 +1189,8 @@ Clause_p clause_tree_find_variant_clause(PTree_p tree, Clause_p cand)
       return NULL;
    }
    clause = tree->key;
-   if(clause_subsumes_clause(clause,cand) &&
+   if(clause->lit_sig == cand->lit_sig &&
+      clause_subsumes_clause(clause,cand) &&
       clause_subsumes_clause(cand, clause))
    {
       return clause;
@@ -1136,6 +1232,24 @@ Clause_p clauseset_find_variant_clause_indexed(FVIndex_p index,
       res = clause_tree_find_variant_clause(index->u1.clauses,
                                             vec->clause);
    }
+   else if(index->flat)
+   {
+      FVLeaf_p  leaf = index->u1.leaf;
+      FVFeature query[FVINDEX_LEAF_WIDTH];
+      long      i;
+
+      FVLeafPackQuery(query, vec, feature);
+      for(i=0; !res && i<leaf->size; i++)
+      {
+         if(FVLeafRowEqual(FVLeafRow(leaf, i), query, leaf->width) &&
+            leaf->clauses[i]->lit_sig == vec->clause->lit_sig &&
+            clause_subsumes_clause(leaf->clauses[i], vec->clause) &&
+            clause_subsumes_clause(vec->clause, leaf->clauses[i]))
+         {
+            res = leaf->clauses[i];
+         }
+      }
+   }
    else if(index->u1.successors)
    {
       next = IntMapGetVal(index->u1.successors, vec->array[feature]);
@@ -44,6 +44,7 @@ PERF_CTR_DECL(SubsumeTimer);
 
 extern bool StrongUnitForwardSubsumption;
 extern long ClauseClauseSubsumptionCalls;
+extern long ClauseClauseSubsumptionSigFails;
 extern long ClauseClauseSubsumptionCallsRec;
 extern long ClauseClauseSubsumptionSuccesses;
 extern long UnitClauseClauseSubsumptionCalls;
@@ -19,6 +19,8 @@ Changes
 
 <1> Sun Jun 23 02:00:52 CEST 2002
     New
+<2> Mon Oct 19 05:33:17 CEST 2026
+    Look up ground units in the ground unit index first
 
 -----------------------------------------------------------------------*/
 
@@ -49,6 +51,60 @@ const SimplifyRes SIMPLIFY_FAILED = {.pos = NULL, .remaining_args = MATCH_FAILED
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: find_ground_unit()
+//
+//   Try to answer a unit search for t1=t2 with the ground unit index
+//   of units, considering units of the allowed signs. Return true
+//   and set *res if the answer is known from it, i.e. if a ground
+//   unit was found, if no unit was ever indexed in units, or if (in
+//   first-order problems) there are no other units that might
+//   match. Return false if the demodulator index has to be searched.
+//
+// Global Variables: problemType
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ bool find_ground_unit(ClauseSet_p units, Term_p t1,
+                                        Term_p t2, bool pos_ok,
+                                        bool neg_ok, SimplifyRes *res)
+{
+   GroundUnitIndex_p index = units->ground_units;
+   ClausePos_p       pos   = NULL;
+
+   if(!index)
+   {
+      *res = SIMPLIFY_FAILED;
+      return true;
+   }
+   if(TermIsGround(t1) && TermIsGround(t2))
+   {
+      if(pos_ok)
+      {
+         pos = GroundUnitIndexFind(index, t1, t2, true);
+      }
+      if(!pos && neg_ok)
+      {
+         pos = GroundUnitIndexFind(index, t1, t2, false);
+      }
+      if(pos)
+      {
+         assert(pos->clause->set == units);
+         *res = (SimplifyRes){.pos = pos, .remaining_args = 0};
+         return true;
+      }
+   }
+   if(problemType == PROBLEM_FO && GroundUnitIndexComplete(index))
+   {
+      *res = SIMPLIFY_FAILED;
+      return true;
+   }
+   return false;
+}
+
 
 
 
@@ -73,7 +129,7 @@ const SimplifyRes SIMPLIFY_FAILED = {.pos = NULL, .remaining_args = MATCH_FAILED
 SimplifyRes FindTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
                Term_p t2)
 {
-   Subst_p     subst = SubstAlloc();
+   Subst_p     subst;
    int remains = MATCH_FAILED;
    ClausePos_p pos;
    SimplifyRes res = SIMPLIFY_FAILED;
@@ -82,6 +138,11 @@ SimplifyRes FindTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
    assert(TermStandardWeight(t2) == TermWeight(t2,DEFAULT_VWEIGHT,DEFAULT_FWEIGHT));
    assert(units && units->demod_index);
 
+   if(find_ground_unit(units, t1, t2, true, true, &res))
+   {
+      return res;
+   }
+   subst = SubstAlloc();
    PDTreeSearchInit(units->demod_index, t1, PDTREE_IGNORE_NF_DATE, false);
 
    MatchRes_p mi;
@@ -122,7 +183,7 @@ SimplifyRes FindTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
 SimplifyRes FindSignedTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
                 Term_p t2, bool sign)
 {
-   Subst_p     subst = SubstAlloc();
+   Subst_p     subst;
    int remains = MATCH_FAILED;
    ClausePos_p pos;
    SimplifyRes res = SIMPLIFY_FAILED;
@@ -131,6 +192,11 @@ SimplifyRes FindSignedTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
    assert(TermStandardWeight(t2) == TermWeight(t2,DEFAULT_VWEIGHT,DEFAULT_FWEIGHT));
    assert(units && units->demod_index);
 
+   if(find_ground_unit(units, t1, t2, sign, !sign, &res))
+   {
+      return res;
+   }
+   subst = SubstAlloc();
    PDTreeSearchInit(units->demod_index, t1, PDTREE_IGNORE_NF_DATE, false);
 
    MatchRes_p mi;
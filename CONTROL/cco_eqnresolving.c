@@ -18,6 +18,8 @@ Changes
 
 <1> Mon Jun  8 17:17:57 MET DST 1998
     New
+<2> Mon Oct 19 09:29:58 CEST 2026
+    Skip variable literals failing the occur check (variable masks)
 
 -----------------------------------------------------------------------*/
 
@@ -41,6 +43,37 @@ Changes
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: var_side_occurs()
+//
+//   Given a literal with at least one variable side, return true if
+//   the variable is known to occur in the other (non-variable) side,
+//   i.e. if the sides are known not to be unifiable.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool var_side_occurs(Eqn_p lit)
+{
+   Term_p var = lit->lterm, term = lit->rterm;
+   VarMask bit;
+
+   if(!TermIsVar(var))
+   {
+      SWAP(var, term);
+   }
+   assert(TermIsVar(var));
+   bit = VarMaskBit(var->f_code);
+
+   return !TermIsVar(term) && VarMaskIsExact(bit) &&
+      (TermVarMask(term) & bit);
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -128,7 +161,8 @@ long ClauseERNormalizeVar(TB_p bank, Clause_p clause, ClauseSet_p
     for(lit = clause->literals; lit; lit = lit->next)
     {
        if(EqnIsNegative(lit)&&
-          (EqnIsPureVar(lit) || (strong&&EqnIsPartVar(lit))))
+          (EqnIsPureVar(lit) ||
+           (strong&&EqnIsPartVar(lit)&&!var_side_occurs(lit))))
        {
           pos->clause  = clause;
           pos->literal = lit;
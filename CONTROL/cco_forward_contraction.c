@@ -105,7 +105,7 @@ static FVPackedClause_p forward_contract_keep(ProofState_p state, ProofControl_p
       }
       assert(!ClauseIsTrivial(clause));
 
-      clause->weight = ClauseStandardWeight(clause);
+      ClauseUpdateSubsumeInfo(clause);
       pclause = FVIndexPackClause(clause, state->processed_non_units->fvindex);
 
       if(clause->pos_lit_no)
@@ -149,7 +149,7 @@ static FVPackedClause_p forward_contract_keep(ProofState_p state, ProofControl_p
       {
          return FVIndexPackClause(clause, NULL);
       }
-      clause->weight = ClauseStandardWeight(clause);
+      ClauseUpdateSubsumeInfo(clause);
       pclause = FVIndexPackClause(clause, state->processed_non_units->fvindex);
    }
    ClauseDelProp(clause, CPIsOriented);
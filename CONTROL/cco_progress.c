@@ -0,0 +1,364 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_progress.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Periodic progress records for external monitoring of the
+  saturation loop. Each record is a single line containing a JSON
+  object.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 02:52:48 CEST 2026
+    New
+<2> Mon Oct 19 09:56:02 CEST 2026
+    Ignore SIGPIPE while writing, stop quietly on EPIPE
+
+-----------------------------------------------------------------------*/
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "cco_progress.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+Progress_p SaturateProgress = NULL;
+
+#define PROGRESS_BUF_SIZE 1024
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: str_is_fd()
+//
+//   Return true if str is a non-empty string of decimal digits.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool str_is_fd(char* str)
+{
+   if(!*str)
+   {
+      return false;
+   }
+   for(; *str; str++)
+   {
+      if(!isdigit((unsigned char)*str))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: connect_unix_socket()
+//
+//   Connect to the (stream) UNIX domain socket at path. Terminate
+//   with an error if this fails.
+//
+// Global Variables: -
+//
+// Side Effects    : Creates and connects the socket.
+//
+/----------------------------------------------------------------------*/
+
+static int connect_unix_socket(char* path)
+{
+   struct sockaddr_un addr;
+   int sock;
+
+   if(strlen(path) >= sizeof(addr.sun_path))
+   {
+      Error("Socket path %s too long", USAGE_ERROR, path);
+   }
+   sock = socket(AF_UNIX, SOCK_STREAM, 0);
+   if(sock == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot create socket for %s", FILE_ERROR, path);
+   }
+   memset(&addr, 0, sizeof(addr));
+   addr.sun_family = AF_UNIX;
+   strcpy(addr.sun_path, path);
+   if(connect(sock, (struct sockaddr*)&addr, sizeof(addr)) == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot connect to socket %s", FILE_ERROR, path);
+   }
+   return sock;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: progress_disable()
+//
+//   Stop writing to the progress stream.
+//
+// Global Variables: -
+//
+// Side Effects    : May close progress->fd
+//
+/----------------------------------------------------------------------*/
+
+static void progress_disable(Progress_p progress)
+{
+   if(progress->owns_fd)
+   {
+      close(progress->fd);
+   }
+   progress->fd = -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: progress_write()
+//
+//   Write len bytes from buf to the progress stream. SIGPIPE is
+//   ignored while writing, so that a reader that has gone away does
+//   not kill the prover. In that case (EPIPE), further reports are
+//   quietly dropped. On other failures, print a warning and disable
+//   further reports.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, may change progress->fd, temporarily
+//                   changes the SIGPIPE disposition.
+//
+/----------------------------------------------------------------------*/
+
+static void progress_write(Progress_p progress, char* buf, int len)
+{
+   ssize_t          res = 0;
+   struct sigaction ignore, old_action;
+
+   memset(&ignore, 0, sizeof(ignore));
+   ignore.sa_handler = SIG_IGN;
+   sigemptyset(&ignore.sa_mask);
+   sigaction(SIGPIPE, &ignore, &old_action);
+
+   while(len)
+   {
+      if(progress->is_socket)
+      {
+         res = send(progress->fd, buf, len, MSG_NOSIGNAL);
+      }
+      else
+      {
+         res = write(progress->fd, buf, len);
+      }
+      if(res < 0)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         if(errno == EPIPE)
+         {
+            VERBOUT("Progress stream closed by reader\n");
+         }
+         else
+         {
+            TmpErrno = errno;
+            SysWarning("Progress stream failed, disabling progress reports");
+         }
+         progress_disable(progress);
+         break;
+      }
+      buf += res;
+      len -= res;
+   }
+   sigaction(SIGPIPE, &old_action, NULL);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProgressAlloc()
+//
+//   Create a progress stream writing to dest, with at least interval
+//   milliseconds between regular records. dest is either a number (an
+//   already open file descriptor), the path of a listening UNIX
+//   domain stream socket, or the name of a file that records are
+//   appended to.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, opens files/sockets
+//
+/----------------------------------------------------------------------*/
+
+Progress_p ProgressAlloc(char* dest, long interval)
+{
+   Progress_p  handle = ProgressCellAlloc();
+   struct stat st;
+
+   handle->is_socket = false;
+   handle->owns_fd   = true;
+   if(str_is_fd(dest))
+   {
+      handle->fd      = atoi(dest);
+      handle->owns_fd = false;
+      if(fstat(handle->fd, &st) == -1)
+      {
+         TmpErrno = errno;
+         SysError("Progress file descriptor %s is not open",
+                  USAGE_ERROR, dest);
+      }
+      handle->is_socket = S_ISSOCK(st.st_mode);
+   }
+   else if(stat(dest, &st) == 0 && S_ISSOCK(st.st_mode))
+   {
+      handle->fd        = connect_unix_socket(dest);
+      handle->is_socket = true;
+   }
+   else
+   {
+      handle->fd = open(dest, O_WRONLY|O_CREAT|O_APPEND, 0666);
+      if(handle->fd == -1)
+      {
+         TmpErrno = errno;
+         SysError("Cannot open file %s", FILE_ERROR, dest);
+      }
+   }
+   handle->interval       = MAX(interval, 0)*1000ll;
+   handle->start_time     = GetUSecTime();
+   handle->last_time      = handle->start_time;
+   handle->next_time      = handle->start_time+handle->interval;
+   handle->last_processed = 0;
+   handle->records        = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProgressFree()
+//
+//   Free a progress stream, closing the descriptor if it was opened
+//   by ProgressAlloc().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ProgressFree(Progress_p junk)
+{
+   if(junk->owns_fd && junk->fd != -1)
+   {
+      close(junk->fd);
+   }
+   ProgressCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProgressReport()
+//
+//   Emit a single progress record for state, tagged with
+//   event. Clauses per second are computed relative to the previous
+//   record. max_rss is the memory high water mark in kB.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void ProgressReport(Progress_p progress, ProofState_p state, char* event)
+{
+   char          buf[PROGRESS_BUF_SIZE];
+   int           len;
+   long long     now = GetUSecTime();
+   double        rate = 0.0;
+   struct rusage usage;
+   long          max_rss = 0;
+
+   progress->next_time = now+progress->interval;
+   if(progress->fd == -1)
+   {
+      return;
+   }
+   if(now > progress->last_time)
+   {
+      rate = (state->processed_count-progress->last_processed)*
+         1000000.0/(now-progress->last_time);
+   }
+   if(getrusage(RUSAGE_SELF, &usage) == 0)
+   {
+      max_rss = usage.ru_maxrss;
+   }
+   len = snprintf(buf, PROGRESS_BUF_SIZE,
+                  "{\"event\": \"%s\", \"pid\": %ld, \"record\": %ld, "
+                  "\"time\": %.3f, \"cpu_time\": %.3f, "
+                  "\"processed\": %lu, \"unprocessed\": %ld, "
+                  "\"generated\": %lu, \"clauses_per_sec\": %.1f, "
+                  "\"term_nodes\": %ld, \"storage\": %ld, "
+                  "\"demod_index_nodes\": %ld, \"fv_index_storage\": %ld, "
+                  "\"max_rss\": %ld}\n",
+                  event, (long)getpid(), progress->records,
+                  (now-progress->start_time)/1000000.0,
+                  GetTotalCPUTime(),
+                  state->processed_count,
+                  state->unprocessed->members,
+                  state->generated_count-state->backward_rewritten_count,
+                  rate,
+                  TBNonVarTermNodes(state->terms),
+                  (long)ProofStateStorage(state),
+                  state->processed_pos_rules->demod_index->node_count+
+                  state->processed_pos_eqns->demod_index->node_count,
+                  FVIndexStorage(state->processed_non_units->fvindex),
+                  max_rss);
+   progress_write(progress, buf, MIN(len, PROGRESS_BUF_SIZE-1));
+
+   progress->records++;
+   progress->last_time      = now;
+   progress->last_processed = state->processed_count;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,77 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_progress.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Periodic, rate-limited progress records emitted from the main
+  saturation loop to a file descriptor, file, or UNIX domain socket,
+  so that an external controller can monitor a running prover.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 02:52:48 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCO_PROGRESS
+
+#define CCO_PROGRESS
+
+#include <ccl_proofstate.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+typedef struct progress_cell
+{
+   int           fd;             /* Destination, -1 if disabled */
+   bool          is_socket;      /* Use send() to avoid SIGPIPE */
+   bool          owns_fd;        /* Close it at the end? */
+   long long     interval;       /* Minimal time between records in
+                                    microseconds */
+   long long     start_time;
+   long long     next_time;      /* Earliest time for next record */
+   long long     last_time;
+   unsigned long last_processed;
+   long          records;
+}ProgressCell, *Progress_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define PROGRESS_DEFAULT_INTERVAL 1000 /* Milliseconds */
+
+/* If set, Saturate() reports to this stream. */
+extern Progress_p SaturateProgress;
+
+#define ProgressCellAlloc()    (ProgressCell*)SizeMalloc(sizeof(ProgressCell))
+#define ProgressCellFree(junk) SizeFree(junk, sizeof(ProgressCell))
+
+Progress_p ProgressAlloc(char* dest, long interval);
+void       ProgressFree(Progress_p junk);
+void       ProgressReport(Progress_p progress, ProofState_p state,
+                          char* event);
+
+#define ProgressCheck(progress, state)                                  \
+   do{ if(UNLIKELY(progress) && GetUSecTime() >= (progress)->next_time) \
+       {ProgressReport((progress), (state), "progress");}}while(0)
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -32,6 +32,12 @@ Changes
 
 PERF_CTR_DEFINE(ParamodTimer);
 PERF_CTR_DEFINE(BWRWTimer);
+PERF_CTR_DEFINE(FWContrTimer);
+PERF_CTR_DEFINE(SatCheckTimer);
+
+/* If set, every non-redundant given clause is written to this stream
+   (e.g. to record workloads for SIMPLE_APPS/kernel_bench). */
+FILE* GivenClauseRecord = NULL;
 
 
 /*---------------------------------------------------------------------*/
@@ -392,7 +398,7 @@ void check_watchlist(GlobalIndices_p indices, ClauseSet_p watchlist,
       ClauseSubsumeOrderSortLits(clause);
       // assert(ClauseIsSubsumeOrdered(clause));
 
-      clause->weight = ClauseStandardWeight(clause);
+      ClauseUpdateSubsumeInfo(clause);
 
       if(static_watchlist)
       {
@@ -488,7 +494,7 @@ void simplify_watchlist(ProofState_p state, ProofControl_p control,
       {
          ClauseRemoveACResolved(handle);
       }
-      handle->weight = ClauseStandardWeight(handle);
+      ClauseUpdateSubsumeInfo(handle);
       ClauseMarkMaximalTerms(control->ocb, handle);
       ClauseSetIndexedInsertClause(state->watchlist, handle);
       // printf("# WL Inserting: "); ClausePrint(stdout, handle, true); printf("\n");
@@ -787,6 +793,7 @@ Clause_p replacing_inferences(ProofState_p state, ProofControl_p
 //   - Remove orphaned clauses
 //   - Simplify all unprocessed clauses
 //   - Reweigh all unprocessed clauses
+//   - Collect the young term cells, a bounded step at a time
 //   - Delete "bad" clauses to avoid running out of memories.
 //
 //   Simplification can find the empty clause, which is then
@@ -855,6 +862,11 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
       ClauseSetReweight(control->hcb,  state->unprocessed);
    }
 
+   GCCollectIncremental(state->gc_terms);
+   if(DerivLogWantsCompaction())
+   {
+      ProofStateCompactDerivLog(state);
+   }
    current_storage  = ProofStateStorage(state);
    if(current_storage > control->heuristic_parms.delete_bad_limit)
    {
@@ -875,7 +887,12 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
       {
          state->state_is_complete = false;
       }
-      GCCollect(state->terms->gc);
+      /* The deleted clauses are mostly old, so only a full
+         collection gives their terms back */
+      GCCollect(state->gc_terms);
+      /* Give the memory of the deleted clauses back to the OS */
+      MemFlushFreeList();
+      MemTrim();
       current_storage = ProofStateStorage(state);
    }
    return unsatisfiable;
@@ -904,6 +921,7 @@ Clause_p SATCheck(ProofState_p state, ProofControl_p control)
       enc_time     = 0.0,
       solver_time  = 0.0;
 
+   PERF_CTR_ENTRY(SatCheckTimer);
    if(control->heuristic_parms.sat_check_normalize)
    {
       //printf("# Cardinality of unprocessed: %ld\n",
@@ -959,6 +977,7 @@ Clause_p SATCheck(ProofState_p state, ProofControl_p control)
       SatClauseSetFree(set);
    }
 
+   PERF_CTR_EXIT(SatCheckTimer);
    return empty;
 }
 
@@ -1421,7 +1440,7 @@ void ProofStateInit(ProofState_p state, ProofControl_p control)
 //   clause if it can be derived, NULL otherwise. This is the core of
 //   the main proof procedure.
 //
-// Global Variables: -
+// Global Variables: GivenClauseRecord
 //
 // Side Effects    : Everything ;-)
 //
@@ -1461,11 +1480,14 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
       arch_copy = ClauseArchiveCopy(state->archive, clause);
    }
 
-   if(!(pclause = ForwardContractClause(state, control,
-                                        clause, true,
-                                        control->heuristic_parms.forward_context_sr,
-                                        control->heuristic_parms.condensing,
-                                        FullRewrite)))
+   PERF_CTR_ENTRY(FWContrTimer);
+   pclause = ForwardContractClause(state, control,
+                                   clause, true,
+                                   control->heuristic_parms.forward_context_sr,
+                                   control->heuristic_parms.condensing,
+                                   FullRewrite);
+   PERF_CTR_EXIT(FWContrTimer);
+   if(!pclause)
    {
       if(arch_copy)
       {
@@ -1491,6 +1513,11 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    check_ac_status(state, control, pclause->clause);
 
    document_processing(pclause->clause);
+   if(UNLIKELY(GivenClauseRecord))
+   {
+      ClauseTSTPPrint(GivenClauseRecord, pclause->clause, true, true);
+      fputc('\n', GivenClauseRecord);
+   }
    state->proc_non_trivial_count++;
 
    resclause = replacing_inferences(state, control, pclause);
@@ -1593,9 +1620,10 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
 //   specified number of clauses has been processed, or the clause set
 //   is saturated. Return empty clause (if found) or NULL.
 //
-// Global Variables: -
+// Global Variables: SaturateProgress, MemStatsRequested
 //
-// Side Effects    : Modifies state.
+// Side Effects    : Modifies state, progress reports, memory
+//                   statistics on request, returns memory to the OS.
 //
 /----------------------------------------------------------------------*/
 
@@ -1624,6 +1652,12 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
          (!state->watchlist||!ClauseSetEmpty(state->watchlist)))
    {
       count++;
+      ProgressCheck(SaturateProgress, state);
+      MemStatsPoll();
+      if(UNLIKELY(MemTrimDue()))
+      {
+         MemTrim();
+      }
       unsatisfiable = ProcessClause(state, control, answer_limit);
       if(unsatisfiable)
       {
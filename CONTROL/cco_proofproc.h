@@ -35,6 +35,7 @@ Changes
 #include <cco_forward_contraction.h>
 #include <cco_interpreted.h>
 #include <ccl_satinterface.h>
+#include <cco_progress.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -49,6 +50,10 @@ Changes
 
 PERF_CTR_DECL(ParamodTimer);
 PERF_CTR_DECL(BWRWTimer);
+PERF_CTR_DECL(FWContrTimer);
+PERF_CTR_DECL(SatCheckTimer);
+
+extern FILE* GivenClauseRecord;
 
 
 /* Collect term cells from temporary clause copies if their number
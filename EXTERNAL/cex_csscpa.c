@@ -296,7 +296,7 @@ bool CSSCPAProcessClause(CSSCPAState_p state, Clause_p clause,
    }
    if(clause_status != rejected)
    {
-      clause->weight = ClauseStandardWeight(clause);
+      ClauseUpdateSubsumeInfo(clause);
 
       if((clause->pos_lit_no &&
           (handle=UnitClauseSetSubsumesClause(state->pos_units,
@@ -0,0 +1,1032 @@
+/*-----------------------------------------------------------------------
+
+File  : che_autotables.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Table-driven auto mode.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 09:11:46 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "che_autotables.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* If set, tables in this file override the built-in ones */
+char* AutoTableFile = NULL;
+
+/* Tables parsed so far, by mode. They are used for selecting both
+   the term ordering and the heuristic, and kept until
+   AutoTablesFree(). */
+static StrTree_p auto_tables = NULL;
+
+static char* auto_param_names[] =
+{
+   "",                          /* APNoParam */
+   "prefer_initial_clauses",
+   "selection_strategy",
+   "select_on_proc_only",
+   "pm_type",
+   "forward_context_sr",
+   "forward_demod",
+   "condensing",
+   "er_varlit_destructive",
+   "er_strong_destructive",
+   "er_aggressive",
+   "split_clauses",
+   "split_aggressive",
+   "split_fresh_defs",
+   "sat_check_grounding",
+   "sat_check_step_limit",
+   "sat_check_decision_limit",
+   "use_tptp_sos",
+   "presat_interreduction",
+   "neg_lit_sel_min",
+   "inherit_paramod_lit",
+   "inherit_goal_pm_lit",
+   "inherit_conj_pm_lit",
+   "ac_handling",
+   "ac_res_aggressive",
+   "forward_context_sr_aggressive",
+   "backward_context_sr",
+   "prefer_general",
+   "condensing_aggressive",
+   "split_method",
+   "sat_check_size_limit",
+   "sat_check_ttinsert_limit",
+   "sat_check_normconst",
+   "sat_check_normalize",
+   "ordertype",
+   "to_weight_gen",
+   "to_prec_gen",
+   "to_const_weight",
+   "no_lit_cmp",
+   NULL
+};
+
+/* As for --ac-handling, in the order of ACHandlingType */
+static char* ac_handling_names[] =
+{
+   "None",
+   "DiscardAll",
+   "KeepUnits",
+   "KeepOrientable",
+   NULL
+};
+
+/* Values of the positions of a class string, in the order of the
+   SpecFeature classifications */
+static char* class_values[AUTO_CLASS_LEN] =
+{
+   "UHG", "UH", "NSP", "FSM", "GN", "FSM", "FSM",
+   "SML", "FSM", "0123", "0123", "SML", "SMD"
+};
+
+#define CHE_AUTOTABLES_INTERNAL
+
+typedef struct
+{
+   char* mode;
+   char* table;
+}AutoTableAssocCell;
+
+static AutoTableAssocCell builtin_tables[] =
+{
+   {"Auto",
+#include "che_X_____auto.c"
+   },
+   {"AutoCASC",
+#include "che_X_____auto_casc.c"
+   },
+   {"AutoDev",
+#include "che_X_____auto_dev.c"
+   },
+   {"AutoSched0",
+#include "che_X_auto_sched0.c"
+   },
+   {"AutoSched1",
+#include "che_X_auto_sched1.c"
+   },
+   {"AutoSched2",
+#include "che_X_auto_sched2.c"
+   },
+   {"AutoSched3",
+#include "che_X_auto_sched3.c"
+   },
+   {"AutoSched4",
+#include "che_X_auto_sched4.c"
+   },
+   {"AutoSched5",
+#include "che_X_auto_sched5.c"
+   },
+   {"AutoSched6",
+#include "che_X_auto_sched6.c"
+   },
+   {"AutoSched7",
+#include "che_X_auto_sched7.c"
+   },
+   {NULL, NULL}
+};
+
+#undef CHE_AUTOTABLES_INTERNAL
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_name_index()
+//
+//   Parse an identifier and return its index in names. Fail with msg
+//   if it is not in there.
+//
+// Global Variables: -
+//
+// Side Effects    : Input
+//
+/----------------------------------------------------------------------*/
+
+static long parse_name_index(Scanner_p in, char* names[], char* msg)
+{
+   long res;
+
+   CheckInpTok(in, Identifier);
+   res = StringIndex(DStrView(AktToken(in)->literal), names);
+   if(res == -1)
+   {
+      AktTokenError(in, msg, false);
+   }
+   NextToken(in);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_setting_parse()
+//
+//   Parse a single <parameter>=<value> and return it as a
+//   setting. Ordering parameters are only accepted if ordering is
+//   true, heuristic parameters only otherwise.
+//
+// Global Variables: TONames, GroundingStratNames, ParamodTypeNames,
+//                   TOWeightGenNames, TOPrecGenNames,
+//                   ac_handling_names
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static AutoSetting_p auto_setting_parse(Scanner_p in, bool ordering)
+{
+   AutoSetting_p handle;
+   AutoParam     param;
+
+   param = parse_name_index(in, auto_param_names, "Unknown parameter");
+   if(param == APNoParam || (param >= APMinOrderParam) != ordering)
+   {
+      AktTokenError(in, ordering?
+                    "Heuristic parameter in ordering()":
+                    "Ordering parameter in heuristic()", false);
+   }
+   AcceptInpTok(in, EqualSign);
+
+   handle = AutoSettingCellAlloc();
+   handle->param   = param;
+   handle->value   = 0;
+   handle->sel_fun = NULL;
+   handle->next    = NULL;
+
+   switch(param)
+   {
+   case APSelectionStrategy:
+         CheckInpTok(in, Identifier);
+         handle->sel_fun = GetLitSelFun(DStrView(AktToken(in)->literal));
+         if(!handle->sel_fun)
+         {
+            AktTokenError(in, "Unknown literal selection function", false);
+         }
+         NextToken(in);
+         break;
+   case APPmType:
+         handle->value = parse_name_index(in, ParamodTypeNames,
+                                          "Unknown paramodulation type");
+         break;
+   case APSatCheckGrounding:
+         handle->value = parse_name_index(in, GroundingStratNames,
+                                          "Unknown grounding strategy");
+         break;
+   case APACHandling:
+         handle->value = parse_name_index(in, ac_handling_names,
+                                          "Unknown AC handling mode");
+         break;
+   case APOrderType:
+         handle->value = parse_name_index(in, TONames,
+                                          "Unknown term ordering");
+         if(handle->value < KBO || handle->value > LPO4Copy)
+         {
+            AktTokenError(in, "Auto-mode table needs a concrete ordering",
+                          false);
+         }
+         break;
+   case APToWeightGen:
+         handle->value = parse_name_index(in, TOWeightGenNames,
+                                          "Unknown weight generation method");
+         break;
+   case APToPrecGen:
+         handle->value = parse_name_index(in, TOPrecGenNames,
+                                          "Unknown precedence generation "
+                                          "method");
+         break;
+   case APForwardDemod:
+   case APSplitClauses:
+   case APSatCheckStepLimit:
+   case APSatCheckDecisionLimit:
+   case APNegLitSelMin:
+   case APSplitMethod:
+   case APSatCheckSizeLimit:
+   case APSatCheckTTInsertLimit:
+   case APToConstWeight:
+         handle->value = ParseInt(in);
+         break;
+   default:
+         CheckInpId(in, "true|false");
+         handle->value = TestInpId(in, "true");
+         NextToken(in);
+         break;
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_settings_parse()
+//
+//   Parse a possibly empty list of settings in brackets and return it.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static AutoSetting_p auto_settings_parse(Scanner_p in, bool ordering)
+{
+   AutoSetting_p res = NULL, *tail = &res;
+
+   AcceptInpTok(in, OpenBracket);
+   if(!TestInpTok(in, CloseBracket))
+   {
+      *tail = auto_setting_parse(in, ordering);
+      tail = &((*tail)->next);
+      while(TestInpTok(in, Comma))
+      {
+         NextToken(in);
+         *tail = auto_setting_parse(in, ordering);
+         tail = &((*tail)->next);
+      }
+   }
+   AcceptInpTok(in, CloseBracket);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_settings_free()
+//
+//   Free a list of settings.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void auto_settings_free(AutoSetting_p junk)
+{
+   AutoSetting_p next;
+
+   while(junk)
+   {
+      next = junk->next;
+      AutoSettingCellFree(junk);
+      junk = next;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_case_parse()
+//
+//   Parse the body of a case, starting with the name of the heuristic
+//   in brackets.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static AutoCase_p auto_case_parse(Scanner_p in)
+{
+   AutoCase_p handle = AutoCaseCellAlloc();
+
+   AcceptInpTok(in, OpenBracket);
+   CheckInpTok(in, Identifier);
+   handle->heuristic = DStrCopy(AktToken(in)->literal);
+   NextToken(in);
+   AcceptInpTok(in, CloseBracket);
+   AcceptInpId(in, "heuristic");
+   handle->heuristic_parms = auto_settings_parse(in, false);
+   AcceptInpId(in, "ordering");
+   handle->order_parms = auto_settings_parse(in, true);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_case_free()
+//
+//   Free a case.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void auto_case_free(AutoCase_p junk)
+{
+   FREE(junk->heuristic);
+   auto_settings_free(junk->heuristic_parms);
+   auto_settings_free(junk->order_parms);
+   AutoCaseCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: class_parse()
+//
+//   Parse a class string and return a copy.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static char* class_parse(Scanner_p in)
+{
+   char *res, *class;
+   int  i;
+
+   CheckInpTok(in, SQString);
+   class = DStrView(AktToken(in)->literal);
+   if(strlen(class) != AUTO_CLASS_LEN+2)
+   {
+      AktTokenError(in, "Problem class has the wrong length", false);
+   }
+   res = DStrCopyCore(AktToken(in)->literal);
+   for(i=0; i<AUTO_CLASS_LEN; i++)
+   {
+      if(res[i]!='-' && !strchr(class_values[i], res[i]))
+      {
+         AktTokenError(in, "Unknown feature value in problem class",
+                       false);
+      }
+   }
+   NextToken(in);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: index_class()
+//
+//   Enter the keys of all classes matching the pattern class (from
+//   position pos on) into the index of the table (unless they are
+//   already associated with an earlier case).
+//
+// Global Variables: class_values
+//
+// Side Effects    : Changes the index
+//
+/----------------------------------------------------------------------*/
+
+static void index_class(AutoTable_p table, char* class, int pos, long key,
+                        long case_no)
+{
+   IntOrP val1, val2;
+   int    i;
+
+   while(pos < AUTO_CLASS_LEN && !table->constrained[pos])
+   {
+      pos++;
+   }
+   if(pos == AUTO_CLASS_LEN)
+   {
+      val1.i_val = case_no;
+      val2.i_val = 0;
+      NumTreeStore(&(table->index), key, val1, val2);
+      return;
+   }
+   for(i=0; class_values[pos][i]; i++)
+   {
+      if(class[pos] == '-' || class[pos] == class_values[pos][i])
+      {
+         index_class(table, class, pos+1, key|((long)i<<(2*pos)),
+                     case_no);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spec_class_values()
+//
+//   For each position of a class string, compute the set of values
+//   (as a bit set) the problem described by spec has. The conditions
+//   are the same as those of the generated if-cascades, which are not
+//   necessarily exclusive (e.g. an empty problem has no and pure
+//   equality).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+#define CLASS_BIT(cond, i) ((cond)?(1<<(i)):0)
+
+static void spec_class_values(SpecFeature_p spec, int values[])
+{
+   values[0]  = CLASS_BIT(SpecAxiomsAreUnit(spec), 0)|
+      CLASS_BIT(SpecAxiomsAreNonUnitHorn(spec), 1)|
+      CLASS_BIT(SpecAxiomsAreGeneral(spec), 2);
+   values[1]  = CLASS_BIT(SpecGoalsAreUnit(spec), 0)|
+      CLASS_BIT(SpecGoalsAreHorn(spec), 1);
+   values[2]  = CLASS_BIT(SpecNoEq(spec), 0)|
+      CLASS_BIT(SpecSomeEq(spec), 1)|
+      CLASS_BIT(SpecPureEq(spec), 2);
+   values[3]  = CLASS_BIT(SpecFewNGPosUnits(spec), 0)|
+      CLASS_BIT(SpecSomeNGPosUnits(spec), 1)|
+      CLASS_BIT(SpecManyNGPosUnits(spec), 2);
+   values[4]  = CLASS_BIT(SpecGoalsAreGround(spec), 0)|
+      CLASS_BIT(SpecGoalsHaveVars(spec), 1);
+   values[5]  = CLASS_BIT(SpecFewAxioms(spec), 0)|
+      CLASS_BIT(SpecSomeAxioms(spec), 1)|
+      CLASS_BIT(SpecManyAxioms(spec), 2);
+   values[6]  = CLASS_BIT(SpecFewLiterals(spec), 0)|
+      CLASS_BIT(SpecSomeLiterals(spec), 1)|
+      CLASS_BIT(SpecManyLiterals(spec), 2);
+   values[7]  = CLASS_BIT(SpecSmallTerms(spec), 0)|
+      CLASS_BIT(SpecMediumTerms(spec), 1)|
+      CLASS_BIT(SpecLargeTerms(spec), 2);
+   values[8]  = CLASS_BIT(SpecFewGroundPos(spec), 0)|
+      CLASS_BIT(SpecSomeGroundPos(spec), 1)|
+      CLASS_BIT(SpecManyGroundPos(spec), 2);
+   values[9]  = CLASS_BIT(SpecMaxFArity0(spec), 0)|
+      CLASS_BIT(SpecMaxFArity1(spec), 1)|
+      CLASS_BIT(SpecMaxFArity2(spec), 2)|
+      CLASS_BIT(SpecMaxFArity3Plus(spec), 3);
+   values[10] = CLASS_BIT(SpecAvgFArity0(spec), 0)|
+      CLASS_BIT(SpecAvgFArity1(spec), 1)|
+      CLASS_BIT(SpecAvgFArity2(spec), 2)|
+      CLASS_BIT(SpecAvgFArity3Plus(spec), 3);
+   values[11] = CLASS_BIT(SpecSmallFArSum(spec), 0)|
+      CLASS_BIT(SpecMediumFArSum(spec), 1)|
+      CLASS_BIT(SpecLargeFArSum(spec), 2);
+   values[12] = CLASS_BIT(SpecShallowMaxDepth(spec), 0)|
+      CLASS_BIT(SpecMediumMaxDepth(spec), 1)|
+      CLASS_BIT(SpecDeepMaxDepth(spec), 2);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lookup_class()
+//
+//   Return the smallest case number associated with a key that
+//   agrees with values (from position pos on), or LONG_MAX.
+//
+// Global Variables: -
+//
+// Side Effects    : Reorganizes the index
+//
+/----------------------------------------------------------------------*/
+
+static long lookup_class(AutoTable_p table, int values[], int pos, long key)
+{
+   NumTree_p cell;
+   long      res = LONG_MAX, tmp;
+   int       i;
+
+   while(pos < AUTO_CLASS_LEN && !table->constrained[pos])
+   {
+      pos++;
+   }
+   if(pos == AUTO_CLASS_LEN)
+   {
+      cell = NumTreeFind(&(table->index), key);
+      return cell?cell->val1.i_val:LONG_MAX;
+   }
+   for(i=0; class_values[pos][i]; i++)
+   {
+      if(values[pos] & (1<<i))
+      {
+         tmp = lookup_class(table, values, pos+1, key|((long)i<<(2*pos)));
+         res = MIN(res, tmp);
+      }
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_table_read()
+//
+//   Parse the table for the given auto mode, from AutoTableFile if
+//   it has one, otherwise the built-in one.
+//
+// Global Variables: AutoTableFile
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static AutoTable_p auto_table_read(char* mode)
+{
+   Scanner_p   in;
+   AutoTable_p res = NULL, table;
+   bool        found;
+   int         i;
+
+   if(AutoTableFile)
+   {
+      in = CreateScanner(StreamTypeFile, AutoTableFile, true, NULL);
+      while(!TestInpTok(in, NoToken))
+      {
+         AcceptInpId(in, "table");
+         AcceptInpTok(in, OpenBracket);
+         CheckInpTok(in, Identifier);
+         found = !res && strcmp(DStrView(AktToken(in)->literal), mode)==0;
+         NextToken(in);
+         AcceptInpTok(in, CloseBracket);
+         table = AutoTableParse(in);
+         if(found)
+         {
+            res = table;
+         }
+         else
+         {
+            AutoTableFree(table);
+         }
+      }
+      DestroyScanner(in);
+      if(res)
+      {
+         return res;
+      }
+   }
+   for(i=0; builtin_tables[i].mode; i++)
+   {
+      if(strcmp(builtin_tables[i].mode, mode)==0)
+      {
+         in = CreateScanner(StreamTypeInternalString,
+                            builtin_tables[i].table, true, NULL);
+         res = AutoTableParse(in);
+         CheckInpTok(in, NoToken);
+         DestroyScanner(in);
+         return res;
+      }
+   }
+   Error("No auto-mode table for %s", USAGE_ERROR, mode);
+   return NULL;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableParse()
+//
+//   Parse an auto-mode table (see che_autotables.h) and index its
+//   classes.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+AutoTable_p AutoTableParse(Scanner_p in)
+{
+   AutoTable_p handle = AutoTableCellAlloc();
+   char        *class;
+   long        case_no, i;
+   int         j;
+
+   handle->cases   = PStackAlloc();
+   handle->classes = PStackAlloc();
+   handle->index   = NULL;
+   for(j=0; j<AUTO_CLASS_LEN; j++)
+   {
+      handle->constrained[j] = false;
+   }
+
+   while(TestInpId(in, "case"))
+   {
+      NextToken(in);
+      case_no = PStackGetSP(handle->cases);
+      PStackPushP(handle->cases, auto_case_parse(in));
+      AcceptInpId(in, "classes");
+      AcceptInpTok(in, OpenBracket);
+      while(true)
+      {
+         class = class_parse(in);
+         for(j=0; j<AUTO_CLASS_LEN; j++)
+         {
+            handle->constrained[j] = handle->constrained[j] ||
+               (class[j] != '-');
+         }
+         PStackPushP(handle->classes, class);
+         PStackPushInt(handle->classes, case_no);
+         if(!TestInpTok(in, Comma))
+         {
+            break;
+         }
+         NextToken(in);
+      }
+      AcceptInpTok(in, CloseBracket);
+   }
+   AcceptInpId(in, "default");
+   handle->default_case = auto_case_parse(in);
+
+   for(i=0; i<PStackGetSP(handle->classes); i+=2)
+   {
+      index_class(handle, PStackElementP(handle->classes, i), 0, 0,
+                  PStackElementInt(handle->classes, i+1));
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableFree()
+//
+//   Free an auto-mode table.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void AutoTableFree(AutoTable_p junk)
+{
+   long i;
+   char *class;
+
+   for(i=0; i<PStackGetSP(junk->cases); i++)
+   {
+      auto_case_free(PStackElementP(junk->cases, i));
+   }
+   PStackFree(junk->cases);
+   for(i=0; i<PStackGetSP(junk->classes); i+=2)
+   {
+      class = PStackElementP(junk->classes, i);
+      FREE(class);
+   }
+   PStackFree(junk->classes);
+   auto_case_free(junk->default_case);
+   NumTreeFree(junk->index);
+   AutoTableCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableGet()
+//
+//   Return the table for the given auto mode (see
+//   auto_table_read()). Tables are parsed once and belong to this
+//   module.
+//
+// Global Variables: auto_tables, AutoTableFile
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+AutoTable_p AutoTableGet(char* mode)
+{
+   StrTree_p   cell;
+   AutoTable_p res;
+   IntOrP      tmp1, tmp2;
+
+   cell = StrTreeFind(&auto_tables, mode);
+   if(cell)
+   {
+      return cell->val1.p_val;
+   }
+   res = auto_table_read(mode);
+   tmp1.p_val = res;
+   tmp2.p_val = NULL;
+   StrTreeStore(&auto_tables, mode, tmp1, tmp2);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTablesFree()
+//
+//   Free all tables returned by AutoTableGet().
+//
+// Global Variables: auto_tables
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void AutoTablesFree(void)
+{
+   StrTree_p cell;
+
+   while(auto_tables)
+   {
+      cell = StrTreeExtractEntry(&auto_tables, auto_tables->key);
+      AutoTableFree(cell->val1.p_val);
+      StrTreeFree(cell);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableLookup()
+//
+//   Return the first case of table matching the class of the problem
+//   described by spec (which has to be evaluated), or the default
+//   case.
+//
+// Global Variables: -
+//
+// Side Effects    : Reorganizes the index
+//
+/----------------------------------------------------------------------*/
+
+AutoCase_p AutoTableLookup(AutoTable_p table, SpecFeature_p spec)
+{
+   int  values[AUTO_CLASS_LEN];
+   long case_no;
+
+   spec_class_values(spec, values);
+   case_no = lookup_class(table, values, 0, 0);
+
+   if(case_no == LONG_MAX)
+   {
+      return table->default_case;
+   }
+   return PStackElementP(table->cases, case_no);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableClassify()
+//
+//   Evaluate spec with respect to limits, print the problem class
+//   and return the case for it.
+//
+// Global Variables: OutputLevel, GlobalOut
+//
+// Side Effects    : Changes spec, output
+//
+/----------------------------------------------------------------------*/
+
+AutoCase_p AutoTableClassify(AutoTable_p table, SpecFeature_p spec,
+                             SpecLimits_p limits)
+{
+   SpecFeaturesAddEval(spec, limits);
+   if(OutputLevel)
+   {
+      fprintf(GlobalOut, "# Problem is type ");
+      SpecTypePrint(GlobalOut, spec, DEFAULT_CLASS_MASK);
+      fputc('\n', GlobalOut);
+   }
+   return AutoTableLookup(table, spec);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoCaseApplyHeuristicParms()
+//
+//   Set the heuristic parameters of the case in parms.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes parms
+//
+/----------------------------------------------------------------------*/
+
+void AutoCaseApplyHeuristicParms(AutoCase_p acase, HeuristicParms_p parms)
+{
+   AutoSetting_p handle;
+
+   for(handle = acase->heuristic_parms; handle; handle = handle->next)
+   {
+      switch(handle->param)
+      {
+      case APPreferInitialClauses:
+            parms->prefer_initial_clauses = handle->value;
+            break;
+      case APSelectionStrategy:
+            parms->selection_strategy = handle->sel_fun;
+            break;
+      case APSelectOnProcOnly:
+            parms->select_on_proc_only = handle->value;
+            break;
+      case APPmType:
+            parms->pm_type = handle->value;
+            break;
+      case APForwardContextSR:
+            parms->forward_context_sr = handle->value;
+            break;
+      case APForwardDemod:
+            parms->forward_demod = handle->value;
+            break;
+      case APCondensing:
+            parms->condensing = handle->value;
+            break;
+      case APERVarlitDestructive:
+            parms->er_varlit_destructive = handle->value;
+            break;
+      case APERStrongDestructive:
+            parms->er_strong_destructive = handle->value;
+            break;
+      case APERAggressive:
+            parms->er_aggressive = handle->value;
+            break;
+      case APSplitClauses:
+            parms->split_clauses = handle->value;
+            break;
+      case APSplitAggressive:
+            parms->split_aggressive = handle->value;
+            break;
+      case APSplitFreshDefs:
+            parms->split_fresh_defs = handle->value;
+            break;
+      case APSatCheckGrounding:
+            parms->sat_check_grounding = handle->value;
+            break;
+      case APSatCheckStepLimit:
+            parms->sat_check_step_limit = handle->value;
+            break;
+      case APSatCheckDecisionLimit:
+            parms->sat_check_decision_limit = handle->value;
+            break;
+      case APUseTPTPSos:
+            parms->use_tptp_sos = handle->value;
+            break;
+      case APPresatInterreduction:
+            parms->presat_interreduction = handle->value;
+            break;
+      case APNegLitSelMin:
+            parms->neg_lit_sel_min = handle->value;
+            break;
+      case APInheritParamodLit:
+            parms->inherit_paramod_lit = handle->value;
+            break;
+      case APInheritGoalPmLit:
+            parms->inherit_goal_pm_lit = handle->value;
+            break;
+      case APInheritConjPmLit:
+            parms->inherit_conj_pm_lit = handle->value;
+            break;
+      case APACHandling:
+            parms->ac_handling = handle->value;
+            break;
+      case APACResAggressive:
+            parms->ac_res_aggressive = handle->value;
+            break;
+      case APForwardContextSRAggressive:
+            parms->forward_context_sr_aggressive = handle->value;
+            break;
+      case APBackwardContextSR:
+            parms->backward_context_sr = handle->value;
+            break;
+      case APPreferGeneral:
+            parms->prefer_general = handle->value;
+            break;
+      case APCondensingAggressive:
+            parms->condensing_aggressive = handle->value;
+            break;
+      case APSplitMethod:
+            parms->split_method = handle->value;
+            break;
+      case APSatCheckSizeLimit:
+            parms->sat_check_size_limit = handle->value;
+            break;
+      case APSatCheckTTInsertLimit:
+            parms->sat_check_ttinsert_limit = handle->value;
+            break;
+      case APSatCheckNormconst:
+            parms->sat_check_normconst = handle->value;
+            break;
+      case APSatCheckNormalize:
+            parms->sat_check_normalize = handle->value;
+            break;
+      default:
+            assert(false && "Ordering parameter in heuristic settings");
+            break;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoCaseApplyOrderParms()
+//
+//   Set the ordering parameters of the case in oparms.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes oparms
+//
+/----------------------------------------------------------------------*/
+
+void AutoCaseApplyOrderParms(AutoCase_p acase, OrderParms_p oparms)
+{
+   AutoSetting_p handle;
+
+   for(handle = acase->order_parms; handle; handle = handle->next)
+   {
+      switch(handle->param)
+      {
+      case APOrderType:
+            oparms->ordertype = handle->value;
+            break;
+      case APToWeightGen:
+            oparms->to_weight_gen = handle->value;
+            break;
+      case APToPrecGen:
+            oparms->to_prec_gen = handle->value;
+            break;
+      case APToConstWeight:
+            oparms->to_const_weight = handle->value;
+            break;
+      case APNoLitCmp:
+            oparms->no_lit_cmp = handle->value;
+            break;
+      default:
+            assert(false && "Heuristic parameter in ordering settings");
+            break;
+      }
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,163 @@
+/*-----------------------------------------------------------------------
+
+File  : che_autotables.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Table-driven auto mode: Association of problem classes with
+  heuristics and term orderings. A table is a sequence of cases
+
+    case(<heuristic>)
+       heuristic(<parameter>=<value>, ...)
+       ordering(<parameter>=<value>, ...)
+       classes('<class>', ...)
+
+  followed by a single default case
+
+    default(<heuristic>) heuristic(...) ordering(...)
+
+  A class is written in the notation of SpecTypePrint(), with '-'
+  for positions that are ignored. The first case with a class matching
+  the problem wins, the default applies if no case does. Parameters
+  are named as in HeuristicParmsCell and OrderParmsCell, values as on
+  the command line of eprover (e.g. to_prec_gen=invfreq).
+
+  The tables of the built-in auto modes are compiled into the binary
+  (they are generated into che_X_*.c). A file of tables, each given
+  as table(<mode>) <cases>, can override them at run time.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 09:11:46 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CHE_AUTOTABLES
+
+#define CHE_AUTOTABLES
+
+#include <clb_numtrees.h>
+#include <clb_stringtrees.h>
+#include <che_to_autoselect.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Length of a class string (see SpecTypePrint()) */
+#define AUTO_CLASS_LEN 13
+
+typedef enum
+{
+   APNoParam = 0,
+   /* Heuristic parameters */
+   APPreferInitialClauses,
+   APSelectionStrategy,
+   APSelectOnProcOnly,
+   APPmType,
+   APForwardContextSR,
+   APForwardDemod,
+   APCondensing,
+   APERVarlitDestructive,
+   APERStrongDestructive,
+   APERAggressive,
+   APSplitClauses,
+   APSplitAggressive,
+   APSplitFreshDefs,
+   APSatCheckGrounding,
+   APSatCheckStepLimit,
+   APSatCheckDecisionLimit,
+   APUseTPTPSos,
+   APPresatInterreduction,
+   APNegLitSelMin,
+   APInheritParamodLit,
+   APInheritGoalPmLit,
+   APInheritConjPmLit,
+   APACHandling,
+   APACResAggressive,
+   APForwardContextSRAggressive,
+   APBackwardContextSR,
+   APPreferGeneral,
+   APCondensingAggressive,
+   APSplitMethod,
+   APSatCheckSizeLimit,
+   APSatCheckTTInsertLimit,
+   APSatCheckNormconst,
+   APSatCheckNormalize,
+   /* Ordering parameters */
+   APOrderType,
+   APToWeightGen,
+   APToPrecGen,
+   APToConstWeight,
+   APNoLitCmp,
+   APMinOrderParam = APOrderType
+}AutoParam;
+
+typedef struct auto_setting_cell
+{
+   AutoParam                 param;
+   long                      value;
+   LiteralSelectionFun       sel_fun; /* For APSelectionStrategy */
+   struct auto_setting_cell* next;
+}AutoSettingCell, *AutoSetting_p;
+
+typedef struct auto_case_cell
+{
+   char          *heuristic;
+   AutoSetting_p heuristic_parms; /* In order of assignment */
+   AutoSetting_p order_parms;
+}AutoCaseCell, *AutoCase_p;
+
+typedef struct auto_table_cell
+{
+   PStack_p   cases;        /* Cases in order of priority */
+   AutoCase_p default_case;
+   PStack_p   classes;      /* Pairs of class string and case index */
+   bool       constrained[AUTO_CLASS_LEN]; /* Position is used by some
+                                              class */
+   NumTree_p  index;        /* Class key -> first matching case */
+}AutoTableCell, *AutoTable_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern char* AutoTableFile;
+
+#define AutoSettingCellAlloc() (AutoSettingCell*) \
+        SizeMalloc(sizeof(AutoSettingCell))
+#define AutoSettingCellFree(junk) \
+        SizeFree(junk, sizeof(AutoSettingCell))
+#define AutoCaseCellAlloc() (AutoCaseCell*)SizeMalloc(sizeof(AutoCaseCell))
+#define AutoCaseCellFree(junk) SizeFree(junk, sizeof(AutoCaseCell))
+#define AutoTableCellAlloc() (AutoTableCell*)SizeMalloc(sizeof(AutoTableCell))
+#define AutoTableCellFree(junk) SizeFree(junk, sizeof(AutoTableCell))
+
+AutoTable_p AutoTableParse(Scanner_p in);
+void        AutoTableFree(AutoTable_p junk);
+AutoTable_p AutoTableGet(char* mode);
+void        AutoTablesFree(void);
+
+AutoCase_p  AutoTableLookup(AutoTable_p table, SpecFeature_p spec);
+AutoCase_p  AutoTableClassify(AutoTable_p table, SpecFeature_p spec,
+                              SpecLimits_p limits);
+
+void AutoCaseApplyHeuristicParms(AutoCase_p acase, HeuristicParms_p parms);
+void AutoCaseApplyOrderParms(AutoCase_p acase, OrderParms_p oparms);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
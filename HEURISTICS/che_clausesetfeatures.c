@@ -36,6 +36,130 @@
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: arity_info_from_distribution()
+//
+//   Compute the arity information described for
+//   ClauseSetCollectArityInformation() from the symbol distribution
+//   dist_array of the clause set. Returns number of function symbol
+//   constants.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long arity_info_from_distribution(Sig_p sig, long *dist_array,
+                                         int *max_fun_arity,
+                                         int *avg_fun_arity,
+                                         int *sum_fun_arity,
+                                         int *max_pred_arity,
+                                         int *avg_pred_arity,
+                                         int *sum_pred_arity,
+                                         int *non_const_funs,
+                                         int *non_const_preds)
+{
+   int max_f_arity = 0,
+      sum_f_arity = 0,
+      f_count = 0,
+      c_count = 0,
+      non_const_p = 0;
+   int max_p_arity = 0,
+      sum_p_arity = 0,
+      p_count = 0;
+   FunCode i;
+
+   for(i=1; i<= sig->f_count; i++)
+   {
+      if(!SigIsSpecial(sig, i)&&dist_array[i])
+      {
+         short arity = SigFindArity(sig, i);
+         if(SigIsPredicate(sig, i))
+         {
+            max_p_arity = MAX(arity, max_p_arity);
+            sum_p_arity += arity;
+            p_count++;
+            if(arity)
+            {
+               non_const_p++;
+            }
+         }
+         else
+         {
+            if(arity)
+            {
+               max_f_arity = MAX(arity, max_f_arity);
+               sum_f_arity += arity;
+               f_count++;
+            }
+            else
+            {
+               c_count++;
+            }
+         }
+      }
+   }
+   *max_fun_arity   = max_f_arity;
+   *avg_fun_arity   = f_count?sum_f_arity/f_count:0;
+   *sum_fun_arity   = sum_f_arity;
+   *max_pred_arity  = max_p_arity;
+   *avg_pred_arity  = p_count?sum_p_arity/p_count:0;
+   *sum_pred_arity  = sum_p_arity;
+   *non_const_funs  = f_count;
+   *non_const_preds = non_const_p;
+
+   return c_count;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spec_features_add_clause()
+//
+//   Add the contribution of clause to the clause counts, the number
+//   of term cells and the TPTP depth information in features (the
+//   sum and number of depths are collected in depthsum and count),
+//   and to the symbol distribution dist_array. Each property of the
+//   clause is computed at most once.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void spec_features_add_clause(SpecFeature_p features,
+                                     Clause_p clause, long *depthsum,
+                                     long *count, long *dist_array)
+{
+   bool goal   = ClauseIsGoal(clause);
+   bool unit   = ClauseIsUnit(clause);
+   bool horn   = ClauseIsHorn(clause);
+   bool demod  = ClauseIsDemodulator(clause);
+   bool pos    = ClauseIsPositive(clause);
+   bool ground = (goal||demod||pos) && ClauseIsGround(clause);
+
+   features->goals      += goal;
+   features->term_cells += ClauseWeight(clause, 1, 1, 1, 1, 1, 1, false);
+   ClauseTPTPDepthInfoAdd(clause, &(features->clause_max_depth),
+                          depthsum, count);
+   features->unit       += unit;
+   features->unitgoals  += unit&&goal;
+   features->horn       += horn;
+   features->horngoals  += horn&&goal;
+   if(ClauseIsEquational(clause))
+   {
+      features->eq_clauses++;
+      features->peq_clauses += ClauseIsPureEquational(clause);
+   }
+   features->groundunitaxioms     += demod&&ground;
+   features->groundgoals          += goal&&ground;
+   features->positiveaxioms       += pos;
+   features->groundpositiveaxioms += pos&&ground;
+   ClauseAddSymbolDistribution(clause, dist_array);
+}
 
 
 /*---------------------------------------------------------------------*/
@@ -558,16 +682,9 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
                                       int *non_const_funs,
                                       int *non_const_preds)
 {
-   int max_f_arity = 0,
-      sum_f_arity = 0,
-      f_count = 0,
-      c_count = 0,
-      non_const_p = 0;
-   int max_p_arity = 0,
-      sum_p_arity = 0,
-      p_count = 0;
    long  array_size = sizeof(long)*(sig->f_count+1);
    long *dist_array = SizeMalloc(array_size);
+   long  res;
    FunCode i;
 
    for(i=1; i<= sig->f_count; i++)
@@ -575,49 +692,14 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
       dist_array[i] = 0;
    }
    ClauseSetAddSymbolDistribution(set, dist_array);
-
-   for(i=1; i<= sig->f_count; i++)
-   {
-      if(!SigIsSpecial(sig, i)&&dist_array[i])
-      {
-         short arity = SigFindArity(sig, i);
-         if(SigIsPredicate(sig, i))
-         {
-            max_p_arity = MAX(arity, max_p_arity);
-            sum_p_arity += arity;
-            p_count++;
-            if(arity)
-            {
-               non_const_p++;
-            }
-         }
-         else
-         {
-            if(arity)
-            {
-               max_f_arity = MAX(arity, max_f_arity);
-               sum_f_arity += arity;
-               f_count++;
-            }
-            else
-            {
-               c_count++;
-            }
-         }
-      }
-   }
+   res = arity_info_from_distribution(sig, dist_array,
+                                      max_fun_arity, avg_fun_arity,
+                                      sum_fun_arity, max_pred_arity,
+                                      avg_pred_arity, sum_pred_arity,
+                                      non_const_funs, non_const_preds);
    SizeFree(dist_array, array_size);
 
-   *max_fun_arity   = max_f_arity;
-   *avg_fun_arity   = f_count?sum_f_arity/f_count:0;
-   *sum_fun_arity   = sum_f_arity;
-   *max_pred_arity  = max_p_arity;
-   *avg_pred_arity  = p_count?sum_p_arity/p_count:0;
-   *sum_pred_arity  = sum_p_arity;
-   *non_const_funs  = f_count;
-   *non_const_preds = non_const_p;
-
-   return c_count;
+   return res;
 }
 
 
@@ -887,7 +969,9 @@ long ClauseSetMaxLiteralNumber(ClauseSet_p set)
 //
 // Function: SpecFeaturesCompute()
 //
-//   Compute all relevant features for a set of clauses.
+//   Compute all relevant features for a set of clauses. All clause
+//   counts, the depth and size information and the symbol
+//   distribution are collected in a single pass over set.
 //
 // Global Variables: -
 //
@@ -898,48 +982,53 @@ long ClauseSetMaxLiteralNumber(ClauseSet_p set)
 void SpecFeaturesCompute(SpecFeature_p features, ClauseSet_p set,
                          Sig_p sig)
 {
-   long tmp, count;
-
-   features->clauses          = set->members;
-   features->goals            = ClauseSetCountGoals(set);
-   features->axioms           = features->clauses-features->goals;
-
-   features->literals         = set->literals;
-   features->term_cells       = ClauseSetTermCells(set);
+   long     depthsum = 0, count = 0;
+   long     array_size = sizeof(long)*(sig->f_count+1);
+   long     *dist_array = SizeMalloc(array_size);
+   Clause_p handle;
+   FunCode  i;
 
-   tmp = 0;
-   count = 0;
-   features->clause_max_depth = 0;
-   ClauseSetTPTPDepthInfoAdd(set,
-                             &(features->clause_max_depth),
-                             &tmp,
-                             &count);
-   features->clause_avg_depth = count?tmp/count:0;
+   for(i=1; i<= sig->f_count; i++)
+   {
+      dist_array[i] = 0;
+   }
+   features->clauses              = set->members;
+   features->literals             = set->literals;
+   features->goals                = 0;
+   features->term_cells           = 0;
+   features->clause_max_depth     = 0;
+   features->unit                 = 0;
+   features->unitgoals            = 0;
+   features->horn                 = 0;
+   features->horngoals            = 0;
+   features->eq_clauses           = 0;
+   features->peq_clauses          = 0;
+   features->groundunitaxioms     = 0;
+   features->groundgoals          = 0;
+   features->positiveaxioms       = 0;
+   features->groundpositiveaxioms = 0;
 
-   features->unit             = ClauseSetCountUnit(set);
-   features->unitgoals        = ClauseSetCountUnitGoals(set);
+   for(handle = set->anchor->succ; handle!=set->anchor; handle =
+          handle->succ)
+   {
+      spec_features_add_clause(features, handle, &depthsum, &count,
+                               dist_array);
+   }
+   features->axioms           = features->clauses-features->goals;
+   features->clause_avg_depth = count?depthsum/count:0;
    features->unitaxioms       = features->unit-features->unitgoals;
-
-   features->horn             = ClauseSetCountHorn(set);
-   features->horngoals        = ClauseSetCountHornGoals(set);
    features->hornaxioms       = features->horn-features->horngoals;
-
-   features->eq_clauses       = ClauseSetCountEquational(set);
-   features->peq_clauses      = ClauseSetCountPureEquational(set);
-   features->groundunitaxioms = ClauseSetCountGroundUnitAxioms(set);
-   features->groundgoals      = ClauseSetCountGroundGoals(set);
-   features->positiveaxioms   = ClauseSetCountPositiveAxioms(set);
-   features->groundpositiveaxioms = ClauseSetCountGroundPositiveAxioms(set);
-   features->fun_const_count   =
-      ClauseSetCollectArityInformation(set, sig,
-                                       &(features->max_fun_arity),
-                                       &(features->avg_fun_arity),
-                                       &(features->sum_fun_arity),
-                                       &(features->max_pred_arity),
-                                       &(features->avg_pred_arity),
-                                       &(features->sum_pred_arity),
-                                       &(features->fun_nonconst_count),
-                                       &(features->pred_nonconst_count));
+   features->fun_const_count  =
+      arity_info_from_distribution(sig, dist_array,
+                                   &(features->max_fun_arity),
+                                   &(features->avg_fun_arity),
+                                   &(features->sum_fun_arity),
+                                   &(features->max_pred_arity),
+                                   &(features->avg_pred_arity),
+                                   &(features->sum_pred_arity),
+                                   &(features->fun_nonconst_count),
+                                   &(features->pred_nonconst_count));
+   SizeFree(dist_array, array_size);
 
    features->goals_are_ground = (features->groundgoals ==
                                  features->goals);
@@ -0,0 +1,282 @@
+/*-----------------------------------------------------------------------
+
+File  : che_evalplan.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Evaluation planning for heuristic control blocks.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 06:43:07 CEST 2026
+    New
+<2> Mon Oct 19 07:23:52 CEST 2026
+    Memoize class counts of large shared terms
+
+-----------------------------------------------------------------------*/
+
+#include "che_evalplan.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: sym_class_map_equal()
+//
+//   Return true if the two classifications are the same.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool sym_class_map_equal(SymClassMap_p m1, SymClassMap_p m2)
+{
+   return m1->ocb == m2->ocb && m1->flimit == m2->flimit &&
+      memcmp(m1->fclass, m2->fclass, m1->flimit) == 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: count_term_classes()
+//
+//   Add the number of symbol occurrences of each class in term to
+//   counts. The counts of large shared terms are taken from/recorded
+//   in memo.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes counts and memo
+//
+/----------------------------------------------------------------------*/
+
+static void count_term_classes(SymClassMap_p classes, TermWeightMemo_p memo,
+                               Term_p term, long* counts)
+{
+   int    i;
+   long   term_counts[SYM_CLASS_NO];
+   double *memo_counts;
+
+   if(TermWeightMemoApplies(memo, term))
+   {
+      if(!(memo_counts = TermWeightMemoFind(memo, term)))
+      {
+         for(i=0; i<SYM_CLASS_NO; i++)
+         {
+            term_counts[i] = 0;
+         }
+         term_counts[term->f_code < classes->flimit?
+                     classes->fclass[term->f_code]:SYM_CLASS_OTHER]++;
+         for(i=0; i<term->arity; i++)
+         {
+            count_term_classes(classes, memo, term->args[i], term_counts);
+         }
+         memo_counts = TermWeightMemoStore(memo, term);
+         for(i=0; i<SYM_CLASS_NO; i++)
+         {
+            memo_counts[i] = term_counts[i];
+         }
+      }
+      for(i=0; i<SYM_CLASS_NO; i++)
+      {
+         counts[i] += memo_counts[i];
+      }
+      return;
+   }
+   while(!TermIsVar(term))
+   {
+      counts[term->f_code < classes->flimit?
+             classes->fclass[term->f_code]:SYM_CLASS_OTHER]++;
+      if(!term->arity)
+      {
+         return;
+      }
+      for(i=0; i<term->arity-1; i++)
+      {
+         count_term_classes(classes, memo, term->args[i], counts);
+      }
+      term = term->args[i];
+   }
+   counts[SYM_CLASS_VAR]++;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: EvalPlanAlloc()
+//
+//   Plan the evaluation for the given WFCBs: Find the WFCBs that can
+//   compute their evaluation from the symbol class counts of the
+//   first classification offered, and fuse them if there are at least
+//   two. Has to be called when the WFCBs can be evaluated (weight
+//   functions may initialize their data when asked for the
+//   classification). Higher-order problems are never fused.
+//
+// Global Variables: problemType
+//
+// Side Effects    : Memory operations, by the WFCBs
+//
+/----------------------------------------------------------------------*/
+
+EvalPlan_p EvalPlanAlloc(PDArray_p wfcb_list, int wfcb_no)
+{
+   EvalPlan_p    handle = EvalPlanCellAlloc();
+   WFCB_p        wfcb;
+   SymClassMap_p classes;
+   int           i, fused_no = 0;
+
+   handle->classes     = NULL;
+   handle->wfcb_no     = wfcb_no;
+   handle->fused       = SizeMalloc(MAX(wfcb_no,1)*sizeof(bool));
+   handle->counts      = NULL;
+   handle->counts_size = 0;
+   handle->memo        = NULL;
+
+   for(i=0; i<wfcb_no; i++)
+   {
+      handle->fused[i] = false;
+      wfcb = PDArrayElementP(wfcb_list, i);
+      if(problemType == PROBLEM_HO ||
+         !wfcb->wfcb_classes || !wfcb->wfcb_class_eval)
+      {
+         continue;
+      }
+      classes = wfcb->wfcb_classes(wfcb->data);
+      if(!classes)
+      {
+         continue;
+      }
+      if(!handle->classes)
+      {
+         handle->classes = classes;
+      }
+      if(sym_class_map_equal(handle->classes, classes))
+      {
+         handle->fused[i] = true;
+         fused_no++;
+      }
+   }
+   if(fused_no < 2)
+   {
+      for(i=0; i<wfcb_no; i++)
+      {
+         handle->fused[i] = false;
+      }
+      handle->classes = NULL;
+   }
+   else
+   {
+      handle->memo = TermWeightMemoAlloc(TERM_WEIGHT_MEMO_BITS, SYM_CLASS_NO);
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: EvalPlanFree()
+//
+//   Free an evaluation plan (the classification belongs to the
+//   WFCBs).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void EvalPlanFree(EvalPlan_p junk)
+{
+   SizeFree(junk->fused, MAX(junk->wfcb_no,1)*sizeof(bool));
+   if(junk->counts)
+   {
+      SizeFree(junk->counts, junk->counts_size*sizeof(long));
+   }
+   if(junk->memo)
+   {
+      TermWeightMemoFree(junk->memo);
+   }
+   EvalPlanCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: EvalPlanCountClasses()
+//
+//   Mark the maximal terms of clause and count the symbol classes of
+//   all its terms in a single pass. Return the counts (valid until the
+//   next call), or NULL if the plan fuses no WFCBs.
+//
+// Global Variables: -
+//
+// Side Effects    : Orients the clause, changes plan
+//
+/----------------------------------------------------------------------*/
+
+long* EvalPlanCountClasses(EvalPlan_p plan, Clause_p clause)
+{
+   long   size, *counts;
+   Eqn_p  handle;
+
+   if(!plan->classes)
+   {
+      return NULL;
+   }
+   ClauseCondMarkMaximalTerms(plan->classes->ocb, clause);
+
+   size = 2*SYM_CLASS_NO*MAX(ClauseLiteralNumber(clause),1);
+   if(size > plan->counts_size)
+   {
+      if(plan->counts)
+      {
+         SizeFree(plan->counts, plan->counts_size*sizeof(long));
+      }
+      plan->counts_size = MAX(size, 2*plan->counts_size);
+      plan->counts = SizeMalloc(plan->counts_size*sizeof(long));
+   }
+   memset(plan->counts, 0, size*sizeof(long));
+
+   counts = plan->counts;
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      count_term_classes(plan->classes, plan->memo, handle->lterm, counts);
+      count_term_classes(plan->classes, plan->memo, handle->rterm,
+                         counts+SYM_CLASS_NO);
+      counts += 2*SYM_CLASS_NO;
+   }
+   return plan->counts;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
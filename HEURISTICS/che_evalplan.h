@@ -0,0 +1,73 @@
+/*-----------------------------------------------------------------------
+
+File  : che_evalplan.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Evaluation planning for heuristic control blocks. Several WFCBs of
+  a heuristic often compute term-level aggregates of the same kind
+  for every new clause (e.g. a number of ConjectureRelativeSymbolWeight
+  instances with different parameters, which all sum per-symbol
+  weights that only depend on the class of a symbol). The plan
+  collects the WFCBs that share a symbol classification, counts the
+  symbol classes of each term of a clause once, and lets each of
+  these WFCBs compute its evaluation from the counts.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 06:43:07 CEST 2026
+    New
+<2> Mon Oct 19 07:23:52 CEST 2026
+    Memoize class counts of large shared terms
+
+-----------------------------------------------------------------------*/
+
+#ifndef CHE_EVALPLAN
+
+#define CHE_EVALPLAN
+
+#include <che_wfcb.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+typedef struct eval_plan_cell
+{
+   SymClassMap_p    classes;     /* Shared classification, NULL if no
+                                    WFCBs are fused */
+   int              wfcb_no;
+   bool             *fused;      /* WFCB i is evaluated from the counts */
+   long             *counts;     /* Class counts of the current clause */
+   long             counts_size;
+   TermWeightMemo_p memo;        /* Class counts of large shared terms */
+}EvalPlanCell, *EvalPlan_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define EvalPlanCellAlloc()    (EvalPlanCell*)SizeMalloc(sizeof(EvalPlanCell))
+#define EvalPlanCellFree(junk) SizeFree(junk, sizeof(EvalPlanCell))
+
+#define EvalPlanIsFused(plan, i) ((plan)->fused[(i)])
+
+EvalPlan_p EvalPlanAlloc(PDArray_p wfcb_list, int wfcb_no);
+void       EvalPlanFree(EvalPlan_p junk);
+long*      EvalPlanCountClasses(EvalPlan_p plan, Clause_p clause);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -19,6 +19,10 @@ Changes
 
 <1> Sat May  7 21:22:32 CEST 2005
     New
+<2> Mon Oct 19 06:43:07 CEST 2026
+    Symbol classes for fused evaluation
+<3> Mon Oct 19 07:23:52 CEST 2026
+    Term weight memo
 
 -----------------------------------------------------------------------*/
 
@@ -42,6 +46,84 @@ Changes
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: conj_sym_class()
+//
+//   Return the symbol class of f for the conjecture-based weights
+//   (predicate/function/constant, conjecture symbol or not).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int conj_sym_class(Sig_p sig, FunCode f, bool conj)
+{
+   int res = SigIsPredicate(sig, f)?2:(SigFindArity(sig, f)?3:4);
+
+   return conj? res+3 : res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: init_conj_classes()
+//
+//   Allocate the symbol class array (to be filled by the caller) and
+//   set the class weights for the conjecture-based weights.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void init_conj_classes(FunWeightParam_p data)
+{
+   assert(data->flimit);
+   data->classes.ocb    = data->ocb;
+   data->classes.flimit = data->flimit;
+   data->classes.fclass = SizeMalloc(data->flimit);
+   data->classes.fclass[0] = SYM_CLASS_OTHER;
+
+   data->class_weights[SYM_CLASS_VAR]   = data->vweight;
+   data->class_weights[SYM_CLASS_OTHER] = data->fweight;
+   data->class_weights[2] = data->pweight;
+   data->class_weights[3] = data->fweight;
+   data->class_weights[4] = data->cweight;
+   data->class_weights[5] = data->conj_pweight;
+   data->class_weights[6] = data->conj_fweight;
+   data->class_weights[7] = data->conj_cweight;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: class_weight()
+//
+//   Return the weight of a term with the given symbol class counts.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ long class_weight(FunWeightParam_p data, long* counts)
+{
+   long res = 0;
+   int  i;
+
+   for(i=0; i<SYM_CLASS_NO; i++)
+   {
+      res += counts[i]*data->class_weights[i];
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: init_conj_vector()
@@ -79,18 +161,23 @@ static void init_conj_vector(FunWeightParam_p data)
             ClauseAddSymbolDistribution(handle, data->fweights);
          }
       }
+      init_conj_classes(data);
       for(i=1;i<data->flimit; i++)
       {
          if(data->fweights[i] == 0)
          {
             data->fweights[i] = SigIsPredicate(data->ocb->sig, i)?data->pweight:
                (SigFindArity(data->ocb->sig,i)?data->fweight:data->cweight);
+            data->classes.fclass[i] = conj_sym_class(data->ocb->sig, i, false);
          }
          else
          {
             data->fweights[i] = SigIsPredicate(data->ocb->sig, i)?data->conj_pweight:
                (SigFindArity(data->ocb->sig,i)?data->conj_fweight:data->conj_cweight);
+            data->classes.fclass[i] = conj_sym_class(data->ocb->sig, i, true);
          }
+         assert(data->fweights[i] ==
+                data->class_weights[data->classes.fclass[i]]);
       }
    }
 }
@@ -142,6 +229,7 @@ static void init_conj_t_vector(FunWeightParam_p data)
          }
       }
 
+      init_conj_classes(data);
       for(i=1;i<data->flimit; i++)
       {
          TypeUniqueID type_uid = SigGetType(sig, i) ? (SigGetType(sig, i))->type_uid : 0;
@@ -149,12 +237,16 @@ static void init_conj_t_vector(FunWeightParam_p data)
          {
             data->fweights[i] = SigIsPredicate(data->ocb->sig, i)?data->pweight:
                (SigFindArity(data->ocb->sig,i)?data->fweight:data->cweight);
+            data->classes.fclass[i] = conj_sym_class(sig, i, false);
          }
          else
          {
             data->fweights[i] = SigIsPredicate(data->ocb->sig, i)?data->conj_pweight:
                (SigFindArity(data->ocb->sig,i)?data->conj_fweight:data->conj_cweight);
+            data->classes.fclass[i] = conj_sym_class(sig, i, true);
          }
+         assert(data->fweights[i] ==
+                data->class_weights[data->classes.fclass[i]]);
       }
 
       for(i=0;i<data->ocb->sig->type_bank->types_count+1;i++)
@@ -481,6 +573,10 @@ FunWeightParam_p FunWeightParamAlloc(void)
    res->f_occur      = NULL;
    res->app_var_mult = 0;
    res->type_freqs   = NULL;
+   res->classes.ocb    = NULL;
+   res->classes.flimit = 0;
+   res->classes.fclass = NULL;
+   res->memo           = NULL;
 
    return res;
 }
@@ -528,6 +624,14 @@ void FunWeightParamFree(FunWeightParam_p junk)
       SizeFree(junk->type_freqs, 
                (junk->ocb->sig->type_bank->types_count+1)*sizeof(long));
    }
+   if(junk->classes.fclass)
+   {
+      SizeFree(junk->classes.fclass, junk->classes.flimit);
+   }
+   if(junk->memo)
+   {
+      TermWeightMemoFree(junk->memo);
+   }
    FunWeightParamCellFree(junk);
 }
 
@@ -564,6 +668,7 @@ WFCB_p ConjectureSymbolWeightInit(ClausePrioFun prio_fun,
                                   void   (*init_fun)(struct funweightparamcell*))
 {
    FunWeightParam_p data = FunWeightParamAlloc();
+   WFCB_p           handle;
 
    data->init_fun               = init_fun;
    data->ocb                    = ocb;
@@ -587,8 +692,12 @@ WFCB_p ConjectureSymbolWeightInit(ClausePrioFun prio_fun,
    /* Weight vector is computed on first call of weight function to
       avoid overhead is many funweigh-based functions are predefined
       */
-   return WFCBAlloc(GenericFunWeightCompute, prio_fun,
-                    GenericFunWeightExit, data);
+   handle = WFCBAlloc(GenericFunWeightCompute, prio_fun,
+                      GenericFunWeightExit, data);
+   handle->wfcb_classes    = GenericFunWeightClasses;
+   handle->wfcb_class_eval = GenericFunWeightClassCompute;
+
+   return handle;
 }
 
 
@@ -1441,7 +1550,7 @@ WFCB_p SymOffsetWeightParse(Scanner_p in, OCB_p ocb,
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Changes data->memo
 //
 /----------------------------------------------------------------------*/
 
@@ -1450,6 +1559,10 @@ double GenericFunWeightCompute(void* data, Clause_p clause)
    FunWeightParam_p local = data;
 
    local->init_fun(data);
+   if(!local->memo)
+   {
+      local->memo = TermWeightMemoAlloc(TERM_WEIGHT_MEMO_BITS, 1);
+   }
    ClauseCondMarkMaximalTerms(local->ocb, clause);
    return ClauseFunWeight(clause,
                           local->max_term_multiplier,
@@ -1460,7 +1573,79 @@ double GenericFunWeightCompute(void* data, Clause_p clause)
                           local->fweights,
                           local->fweight,
                           local->app_var_mult,
-                          local->type_freqs);
+                          local->type_freqs,
+                          local->memo);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GenericFunWeightClasses()
+//
+//   Return the symbol classification of the weights (if they only
+//   depend on the symbol class), or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : Initializes the weights
+//
+/----------------------------------------------------------------------*/
+
+SymClassMap_p GenericFunWeightClasses(void* data)
+{
+   FunWeightParam_p local = data;
+
+   local->init_fun(data);
+   return local->classes.fclass? &(local->classes) : NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GenericFunWeightClassCompute()
+//
+//   Compute the same evaluation as GenericFunWeightCompute() from
+//   the symbol class counts of the (first-order) clause.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double GenericFunWeightClassCompute(void* data, Clause_p clause,
+                                    long* counts)
+{
+   FunWeightParam_p local = data;
+   Eqn_p  handle;
+   double res = 0, lit_res;
+
+   assert(local->classes.fclass);
+   assert(problemType != PROBLEM_HO);
+
+   ClauseCondMarkMaximalTerms(local->ocb, clause);
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      lit_res = (double)class_weight(local, counts+SYM_CLASS_NO);
+      if(!EqnIsOriented(handle))
+      {
+         lit_res *= local->max_term_multiplier;
+      }
+      lit_res += (double)class_weight(local, counts)*
+         local->max_term_multiplier;
+      if(EqnIsMaximal(handle))
+      {
+         lit_res = lit_res*local->max_literal_multiplier;
+      }
+      if(EqnIsPositive(handle))
+      {
+         lit_res = lit_res*local->pos_multiplier;
+      }
+      res += lit_res;
+      counts += 2*SYM_CLASS_NO;
+   }
+   assert(res == GenericFunWeightCompute(data, clause));
+   return res;
 }
 
 
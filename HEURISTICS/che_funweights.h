@@ -19,6 +19,10 @@ Changes
 
 <1> Sat May  7 20:57:21 CEST 2005
     New
+<2> Mon Oct 19 06:43:07 CEST 2026
+    Symbol classes for fused evaluation
+<3> Mon Oct 19 07:23:52 CEST 2026
+    Term weight memo
 
 -----------------------------------------------------------------------*/
 
@@ -81,6 +85,16 @@ typedef struct funweightparamcell
    /* array storing frequencies of types for certain symbols */
    long   *type_freqs;
 
+   /* If the weights only depend on the class of the symbol (see
+    * che_wfcb.h), classes.fclass holds the classes and class_weights
+    * their weights, otherwise classes.fclass is NULL. */
+   SymClassMapCell classes;
+   long            class_weights[SYM_CLASS_NO];
+
+   /* Memoized weights of large shared terms (the weights never change
+    * once initialized) */
+   TermWeightMemo_p memo;
+
    /* Temporary store for function symbol counts, put here to avoid
     * multiple  (expensive for large signatures) initializations. */
    PDArray_p f_occur;
@@ -162,6 +176,9 @@ WFCB_p SymOffsetWeightParse(Scanner_p in, OCB_p ocb,
                             ProofState_p state);
 
 double GenericFunWeightCompute(void* data, Clause_p clause);
+SymClassMap_p GenericFunWeightClasses(void* data);
+double GenericFunWeightClassCompute(void* data, Clause_p clause,
+                                    long* counts);
 
 double SymOffsetWeightCompute(void* data, Clause_p clause);
 
@@ -228,6 +228,7 @@ HCB_p HCBAlloc(void)
 
    handle->wfcb_list     = PDArrayAlloc(4,4);
    handle->wfcb_no       = 0;
+   handle->plan          = NULL;
    handle->current_eval  = 0;
    handle->select_switch = PDArrayAlloc(4,4);
    handle->select_count  = 0;
@@ -258,6 +259,10 @@ void HCBFree(HCB_p junk)
       anyways! */
    PDArrayFree(junk->wfcb_list);
    PDArrayFree(junk->select_switch);
+   if(junk->plan)
+   {
+      EvalPlanFree(junk->plan);
+   }
    if(junk->data)
    {
       junk->hcb_exit(junk->data);
@@ -289,6 +294,11 @@ long HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps)
    {
       steps+= PDArrayElementInt(hcb->select_switch, hcb->wfcb_no-1);
    }
+   if(hcb->plan)
+   {
+      EvalPlanFree(hcb->plan);
+      hcb->plan = NULL;
+   }
    PDArrayAssignP(hcb->wfcb_list, hcb->wfcb_no, wfcb);
    PDArrayAssignInt(hcb->select_switch, hcb->wfcb_no, steps);
    hcb->wfcb_no++;
@@ -305,7 +315,9 @@ long HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps)
 //
 // Function: HCBClauseEvaluate()
 //
-//   Giben a HCB-Block, add evaluations to the given clause.
+//   Giben a HCB-Block, add evaluations to the given clause. WFCBs
+//   fused by the evaluation plan share a single pass over the terms
+//   of the clause.
 //
 // Global Variables: -
 //
@@ -315,17 +327,33 @@ long HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps)
 
 void HCBClauseEvaluate(HCB_p hcb, Clause_p clause)
 {
-   long i;
-   bool empty;
+   long  i;
+   bool  empty;
+   long* counts;
 
    PERF_CTR_ENTRY(ClauseEvalTimer);
    assert(clause->evaluations == NULL);
    ClauseAddEvalCell(clause, EvalsAlloc(hcb->wfcb_no));
 
+   if(!hcb->plan)
+   {
+      hcb->plan = EvalPlanAlloc(hcb->wfcb_list, hcb->wfcb_no);
+   }
+   counts = EvalPlanCountClasses(hcb->plan, clause);
+
    empty = ClauseIsSemFalse(clause);
    for(i=0; i< hcb->wfcb_no; i++)
    {
-      ClauseAddEvaluation(PDArrayElementP(hcb->wfcb_list, i), clause, i, empty);
+      if(counts && EvalPlanIsFused(hcb->plan, i))
+      {
+         ClauseAddClassEvaluation(PDArrayElementP(hcb->wfcb_list, i),
+                                  clause, i, empty, counts);
+      }
+      else
+      {
+         ClauseAddEvaluation(PDArrayElementP(hcb->wfcb_list, i),
+                             clause, i, empty);
+      }
    }
    PERF_CTR_EXIT(ClauseEvalTimer);
 }
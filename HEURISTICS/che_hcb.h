@@ -35,6 +35,7 @@
 #include <ccl_clausefunc.h>
 #include <che_wfcbadmin.h>
 #include <che_litselection.h>
+#include <che_evalplan.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -159,6 +160,10 @@ typedef struct hcb_cell
    PDArray_p       wfcb_list;
    int             wfcb_no;
 
+   /* How to evaluate a clause with all WFCBs, computed on the first
+      evaluation. */
+   EvalPlan_p      plan;
+
    /* Evaluation currently used for selection. This refers to the
       order of evaluations in the clause. See above!       */
    int             current_eval;
@@ -19,6 +19,8 @@ Changes
 
 <1> Mon Jun  8 02:14:51 MET DST 1998
     New
+<2> Mon Oct 19 09:11:46 CEST 2026
+    Auto modes are selected from class tables (che_autotables.c)
 
 -----------------------------------------------------------------------*/
 
@@ -97,6 +99,42 @@ void finalize_auto_parms(char* modename, char* hname,
    }
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: auto_mode_create()
+//
+//   Classify the proof problem with the auto-mode table for mode, set
+//   the heuristic parameters of the selected case, and return its
+//   heuristic. Frees limits.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, output
+//
+/----------------------------------------------------------------------*/
+
+static HCB_p auto_mode_create(char* mode, char* modename,
+                              SpecLimits_p limits, HCBARGUMENTS)
+{
+   SpecFeature_p spec = &(control->problem_specs);
+   AutoTable_p   table = AutoTableGet(mode);
+   AutoCase_p    acase;
+   HCB_p         res;
+
+   control->heuristic_parms.selection_strategy = SelectNoLiterals;
+   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
+   acase = AutoTableClassify(table, spec, limits);
+   AutoCaseApplyHeuristicParms(acase, &(control->heuristic_parms));
+   SpecLimitsCellFree(limits);
+
+   finalize_auto_parms(modename, acase->heuristic, control, parms, spec);
+
+   res = GetHeuristic(acase->heuristic, state, control, parms);
+
+   return res;
+}
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -188,8 +226,6 @@ HCB_p GetHeuristic(char* source, HCBARGUMENTS)
 
 
 
-#define CHE_HEURISTICS_INTERNAL
-
 /*-----------------------------------------------------------------------
 //
 // Function: HCBAutoModeCreate()
@@ -203,31 +239,11 @@ HCB_p GetHeuristic(char* source, HCBARGUMENTS)
 //
 /----------------------------------------------------------------------*/
 
-#define CHE_HEURISTICS_AUTO
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoModeCreate(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("Auto-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("Auto", "Auto-Mode", CreateDefaultSpecLimits(),
+                           state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO
 
 
 /*-----------------------------------------------------------------------
@@ -243,18 +259,8 @@ GCC_DIAGNOSTIC_POP
 //
 /----------------------------------------------------------------------*/
 
-#define CHE_HEURISTICS_AUTO_CASC
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBCASCAutoModeCreate(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
    SpecLimits_p limits =  SpecLimitsAlloc();
 
    limits->ax_some_limit        = 46;
@@ -274,17 +280,9 @@ HCB_p HCBCASCAutoModeCreate(HCBARGUMENTS)
    limits->ngu_few_limit        = 1;
    limits->ngu_many_limit       = 3;
 
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("Auto-Mode (CASC-20)", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoCASC", "Auto-Mode (CASC-20)", limits,
+                           state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_CASC
 
 
 /*-----------------------------------------------------------------------
@@ -300,32 +298,11 @@ GCC_DIAGNOSTIC_POP
 //
 /----------------------------------------------------------------------*/
 
-
-#define CHE_HEURISTICS_AUTO_DEV
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBDevAutoModeCreate(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("AutoDev-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoDev", "AutoDev-Mode",
+                           CreateDefaultSpecLimits(), state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_DEV
 
 
 /*-----------------------------------------------------------------------
@@ -335,6 +312,9 @@ GCC_DIAGNOSTIC_POP
 // Function: HCBAutoSched2Create()
 // Function: HCBAutoSched3Create()
 // Function: HCBAutoSched4Create()
+// Function: HCBAutoSched5Create()
+// Function: HCBAutoSched6Create()
+// Function: HCBAutoSched7Create()
 //
 //   Auto-mode variants for strategy-scheduling
 //
@@ -344,226 +324,56 @@ GCC_DIAGNOSTIC_POP
 //
 /----------------------------------------------------------------------*/
 
-#define CHE_HEURISTICS_AUTO_SCHED0
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched0Create(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("AutoSched0-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoSched0", "AutoSched0-Mode",
+                           CreateDefaultSpecLimits(), state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED0
 
-#define CHE_HEURISTICS_AUTO_SCHED1
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched1Create(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("AutoSched1-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoSched1", "AutoSched1-Mode",
+                           CreateDefaultSpecLimits(), state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED1
-
-#define CHE_HEURISTICS_AUTO_SCHED2
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched2Create(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("AutoSched2-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoSched2", "AutoSched2-Mode",
+                           CreateDefaultSpecLimits(), state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED2
-
-#define CHE_HEURISTICS_AUTO_SCHED3
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched3Create(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("AutoSched3-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoSched3", "AutoSched3-Mode",
+                           CreateDefaultSpecLimits(), state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED3
 
-
-#define CHE_HEURISTICS_AUTO_SCHED4
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched4Create(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("AutoSched4-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoSched4", "AutoSched4-Mode",
+                           CreateDefaultSpecLimits(), state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED4
-
-
-#define CHE_HEURISTICS_AUTO_SCHED5
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched5Create(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("AutoSched5-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoSched5", "AutoSched5-Mode",
+                           CreateDefaultSpecLimits(), state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED5
-
 
-#define CHE_HEURISTICS_AUTO_SCHED6
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched6Create(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("AutoSched6-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoSched6", "AutoSched6-Mode",
+                           CreateDefaultSpecLimits(), state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED6
-
 
-#define CHE_HEURISTICS_AUTO_SCHED7
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched7Create(HCBARGUMENTS)
 {
-   char *res = "Default";
-   SpecFeature_p spec = &(control->problem_specs);
-   SpecLimits_p limits = CreateDefaultSpecLimits();
-
-   control->heuristic_parms.selection_strategy = SelectNoLiterals;
-   OUTPRINT(1, "# Auto-Heuristic is analysing problem.\n");
-#include "che_auto_cases.c"
-   SpecLimitsCellFree(limits);
-
-   finalize_auto_parms("AutoSched7-Mode", res, control, parms, spec);
-
-   return GetHeuristic(res, state, control, parms);
+   return auto_mode_create("AutoSched7", "AutoSched7-Mode",
+                           CreateDefaultSpecLimits(), state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED7
-
-
 
 
-#undef CHE_HEURISTICS_INTERNAL
-
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
-
-
@@ -25,7 +25,7 @@ Changes
 
 #define CHE_HEURISTICS
 
-#include <che_proofcontrol.h>
+#include <che_autotables.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -63,45 +63,130 @@
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
-static PStack_p lev_compute_term_code(Term_p term)
+/* Symbol index for symbols that do not occur in any conjecture code */
+#define LEV_NO_SYMBOL -1
+
+/* Term codes up to this length are handled by the bit-parallel
+   algorithm */
+#define LEV_BP_MAX_LEN 64
+
+/*-----------------------------------------------------------------------
+//
+// Function: lev_symbol()
+//
+//   Return the symbol index of f_code (a function symbol or a
+//   normalized variable). If extend is true, unknown symbols get a new
+//   index, otherwise LEV_NO_SYMBOL is returned for them.
+//
+// Global Variables: -
+//
+// Side Effects    : May extend data->symbols
+//
+/----------------------------------------------------------------------*/
+
+static long lev_symbol(LevWeightParam_p data, FunCode f_code, bool extend)
 {
-   PStack_p stack;
-   PStack_p code;
-   Term_p sub_term;
+   long key = (f_code >= 0)? 2*f_code : -2*f_code+1;
+   long res = PDArrayElementInt(data->symbols, key);
 
-   code = PStackAlloc();
-   stack = PStackAlloc();
-   
-   TermLRTraverseInit(stack,term);
-   while ((sub_term = TermLRTraverseNext(stack))) {
-      PStackPushInt(code,sub_term->f_code);
+   if(!res)
+   {
+      if(!extend)
+      {
+         return LEV_NO_SYMBOL;
+      }
+      res = ++(data->sym_count);
+      PDArrayAssignInt(data->symbols, key, res);
    }
-   PStackFree(stack);
+   return res-1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lev_norm_var()
+//
+//   Return the f_code of var after variable normalization in the
+//   style of TermCopyNormalizeVars(). data->norm_vars holds the
+//   variables seen so far in the current term (in LR order).
+//
+// Global Variables: -
+//
+// Side Effects    : May change data->norm_vars
+//
+/----------------------------------------------------------------------*/
+
+static FunCode lev_norm_var(LevWeightParam_p data, Term_p var)
+{
+   PStackPointer i;
+
+   switch(data->var_norm)
+   {
+   case NSUnivar:
+         return -2;
+   case NSAlpha:
+         for(i=0; i<PStackGetSP(data->norm_vars); i++)
+         {
+            if(PStackElementInt(data->norm_vars, i) == var->f_code)
+            {
+               break;
+            }
+         }
+         if(i == PStackGetSP(data->norm_vars))
+         {
+            PStackPushInt(data->norm_vars, var->f_code);
+         }
+         return -2*(i+1);
+   default:
+         return var->f_code;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lev_compute_term_code()
+//
+//   Compute the code (the symbol indices in LR order) of the variable
+//   normalized version of term into code. This gives the same code as
+//   traversing TermCopyNormalizeVars(), without creating the copy.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes code, see lev_symbol()
+//
+/----------------------------------------------------------------------*/
+
+static void lev_compute_term_code(LevWeightParam_p data, Term_p term,
+                                  PStack_p code, bool extend)
+{
+   Term_p  sub_term;
+   FunCode f_code;
 
-   return code;
+   PStackReset(code);
+   PStackReset(data->norm_vars);
+   TermLRTraverseInit(data->trav_stack, term);
+   while((sub_term = TermLRTraverseNext(data->trav_stack)))
+   {
+      f_code = TermIsVar(sub_term)?
+         lev_norm_var(data, sub_term) : sub_term->f_code;
+      PStackPushInt(code, lev_symbol(data, f_code, extend));
+   }
 }
 
 static void lev_insert_term(
-   PStack_p codes,
-   Term_p term, 
-   VarBank_p vars, 
-   VarNormStyle var_norm)
+   LevWeightParam_p data,
+   Term_p term)
 {
-   Term_p norm;
-   PStack_p code;
-  
-   norm = TermCopyNormalizeVars(vars,term,var_norm);
-   code = lev_compute_term_code(norm);
-   PStackPushP(codes,code);
+   PStack_p code = PStackAlloc();
 
-   TermFree(norm);
+   lev_compute_term_code(data, term, code, true);
+   PStackPushP(data->codes, code);
 }
 
 static void lev_insert_subterms(
-   PStack_p codes,
-   Term_p term, 
-   VarBank_p vars, 
-   VarNormStyle var_norm)
+   LevWeightParam_p data,
+   Term_p term)
 {
    int i;
    PStack_p stack;
@@ -116,7 +201,7 @@ static void lev_insert_subterms(
       if(TermIsVar(subterm)) {
          continue;
       }
-      lev_insert_term(codes,subterm,vars,var_norm);
+      lev_insert_term(data,subterm);
 
       for(i=0; i<subterm->arity; i++)
       {
@@ -128,38 +213,33 @@ static void lev_insert_subterms(
 }
 
 static void lev_insert_topgens(
-   PStack_p codes, 
-   Term_p term, 
-   VarBank_p vars,
-   Sig_p sig,
-   VarNormStyle var_norm)
+   LevWeightParam_p data,
+   Term_p term)
 {
    int i;
    PStack_p topgens;
    Term_p topgen;
 
-   topgens = ComputeTopGeneralizations(term,vars,sig);
+   topgens = ComputeTopGeneralizations(term,data->vars,data->ocb->sig);
    for (i=0; i<topgens->current; i++) {
       topgen = topgens->stack[i].p_val;
-      lev_insert_term(codes,topgen,vars,var_norm);
+      lev_insert_term(data,topgen);
    }
    FreeGeneralizations(topgens);
 }
 
 static void lev_insert_subgens(
-   PStack_p codes, 
-   Term_p term, 
-   VarBank_p vars, 
-   VarNormStyle var_norm)
+   LevWeightParam_p data,
+   Term_p term)
 {
    int i;
    PStack_p subgens;
    Term_p genterm;
 
-   subgens = ComputeSubtermsGeneralizations(term,vars);
+   subgens = ComputeSubtermsGeneralizations(term,data->vars);
    for (i=0; i<subgens->current; i++) {
       genterm = subgens->stack[i].p_val;
-      lev_insert_term(codes,genterm,vars,var_norm);
+      lev_insert_term(data,genterm);
    }
    FreeGeneralizations(subgens);
 }
@@ -177,6 +257,10 @@ static void lev_init(LevWeightParam_p data)
 
    data->codes = PStackAlloc();
    data->vars = VarBankAlloc(data->proofstate->signature->type_bank);
+   data->symbols = PDIntArrayAlloc(64, 0);
+   data->term_code = PStackAlloc();
+   data->trav_stack = PStackAlloc();
+   data->norm_vars = PStackAlloc();
    
    // for each axiom ...
    anchor = data->proofstate->axioms->anchor;
@@ -193,32 +277,22 @@ static void lev_init(LevWeightParam_p data)
          switch (data->rel_terms) 
          {
          case RTSConjectureTerms:
-            lev_insert_term(
-               data->codes,lit->lterm,data->vars,data->var_norm);
-            lev_insert_term(
-               data->codes,lit->rterm,data->vars,data->var_norm);
+            lev_insert_term(data,lit->lterm);
+            lev_insert_term(data,lit->rterm);
             break;
          case RTSConjectureSubterms:
-            lev_insert_subterms(
-               data->codes,lit->lterm,data->vars,data->var_norm);
-            lev_insert_subterms(
-               data->codes,lit->rterm,data->vars,data->var_norm);
+            lev_insert_subterms(data,lit->lterm);
+            lev_insert_subterms(data,lit->rterm);
             break;
          case RTSConjectureSubtermsTopGens:
-            lev_insert_subterms(
-               data->codes,lit->lterm,data->vars,data->var_norm);
-            lev_insert_subterms(
-               data->codes,lit->rterm,data->vars,data->var_norm);
-            lev_insert_topgens(data->codes,lit->lterm,data->vars,
-               data->ocb->sig,data->var_norm);
-            lev_insert_topgens(data->codes,lit->rterm,data->vars,
-               data->ocb->sig,data->var_norm);
+            lev_insert_subterms(data,lit->lterm);
+            lev_insert_subterms(data,lit->rterm);
+            lev_insert_topgens(data,lit->lterm);
+            lev_insert_topgens(data,lit->rterm);
             break;
          case RTSConjectureSubtermsAllGens:
-            lev_insert_subgens(
-               data->codes,lit->lterm,data->vars,data->var_norm);
-            lev_insert_subgens(
-               data->codes,lit->rterm,data->vars,data->var_norm);
+            lev_insert_subgens(data,lit->lterm);
+            lev_insert_subgens(data,lit->rterm);
             break;
          default:
             Error("ConjectureLevDistanceWeight parameters usage error (unsupported RelatedTermSet %d)", USAGE_ERROR, data->rel_terms);
@@ -226,22 +300,42 @@ static void lev_init(LevWeightParam_p data)
          }
       }
    }
+   data->peq = SizeMalloc(MAX(data->sym_count,1)*sizeof(uint64_t));
+   memset(data->peq, 0, MAX(data->sym_count,1)*sizeof(uint64_t));
 }
 
-static double lev_codes_distance(
+/*-----------------------------------------------------------------------
+//
+// Function: lev_codes_distance()
+//
+//   Return the weighted edit distance between code1 and code2 if it
+//   is smaller than bound, bound otherwise. Plain dynamic programming
+//   over the columns of the distance matrix. As costs are not
+//   negative, the column minimum never decreases, so the computation
+//   stops as soon as it reaches bound.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long lev_codes_distance(
    PStack_p code1,
    PStack_p code2,
    int ins_cost, 
    int del_cost, 
-   int ch_cost)
+   int ch_cost,
+   long bound)
 {
-   unsigned int x, y, lastdiag, olddiag;
-   unsigned int del, ins, ch;
-   FunCode* s1 = (FunCode*)code1->stack;
-   FunCode* s2 = (FunCode*)code2->stack;
+   unsigned int x, y;
+   long lastdiag, olddiag, colmin;
+   long del, ins, ch;
+   IntOrP* s1 = code1->stack;
+   IntOrP* s2 = code2->stack;
    unsigned int s1len = code1->current;
    unsigned int s2len = code2->current;
-   unsigned int column[s1len+1];
+   long column[s1len+1];
 
    for (y=0; y<=s1len; y++) 
    {
@@ -249,44 +343,176 @@ static double lev_codes_distance(
    }
    for (x=1;x<=s2len; x++) 
    {
-      column[0] = x*ins_cost;;
+      column[0] = colmin = x*ins_cost;
       for (y=1,lastdiag=(x-1)*ins_cost; y<=s1len; y++) 
       {
          olddiag = column[y];
          del = column[y]+del_cost;
          ins = column[y-1]+ins_cost;
-         ch = lastdiag+(s1[y-1]==s2[x-1] ? 0 : ch_cost);
+         ch = lastdiag+(s1[y-1].i_val==s2[x-1].i_val ? 0 : ch_cost);
          column[y] = MIN3(del,ins,ch);
+         colmin = MIN(colmin, column[y]);
          lastdiag = olddiag;
       }
+      if(colmin >= bound)
+      {
+         return bound;
+      }
    }
 
-   return(column[s1len]);
+   return MIN(column[s1len], bound);
 }
 
-static double lev_term_weight(Term_p term, LevWeightParam_p data)
+/*-----------------------------------------------------------------------
+//
+// Function: lev_codes_distance_bp()
+//
+//   Return the unit cost edit distance between pattern (whose match
+//   vectors have been set up in peq) and text if it is smaller than
+//   bound, bound otherwise. Bit-parallel algorithm of Myers (in
+//   Hyyrö's formulation) for patterns of at most 64 symbols. The
+//   score (the last row of the current column) changes by at most
+//   one per text symbol, so the loop stops if bound can no longer be
+//   undercut.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long lev_codes_distance_bp(
+   uint64_t *peq,
+   long pat_len,
+   PStack_p text,
+   long bound)
 {
-   int i;
-   double min;
-   PStack_p norm_code;
-   PStack_p conj_code;
-   Term_p norm;
+   uint64_t pv = ~(uint64_t)0, mv = 0, eq, xv, xh, ph, mh;
+   uint64_t last = (uint64_t)1<<(pat_len-1);
+   long     score = pat_len, j, text_len = PStackGetSP(text);
 
-   norm = TermCopyNormalizeVars(data->vars,term,data->var_norm);
-   norm_code = lev_compute_term_code(norm);
+   if(labs(text_len-pat_len) >= bound)
+   {
+      return bound;
+   }
+   for(j=0; j<text_len; j++)
+   {
+      eq = peq[PStackElementInt(text, j)];
+      xv = eq | mv;
+      xh = (((eq & pv) + pv) ^ pv) | eq;
+      ph = mv | ~(xh | pv);
+      mh = pv & xh;
+      if(ph & last)
+      {
+         score++;
+      }
+      else if(mh & last)
+      {
+         score--;
+      }
+      if(score-(text_len-j-1) >= bound)
+      {
+         return bound;
+      }
+      ph = (ph << 1) | 1;
+      mh = mh << 1;
+      pv = mh | ~(xv | ph);
+      mv = ph & xv;
+   }
+   return score;
+}
 
-   min = DBL_MAX;
+/*-----------------------------------------------------------------------
+//
+// Function: lev_term_distance()
+//
+//   Return the minimal distance of code to any conjecture code.
+//
+// Global Variables: -
+//
+// Side Effects    : Uses data->peq as scratch space
+//
+/----------------------------------------------------------------------*/
+
+static long lev_term_distance(LevWeightParam_p data, PStack_p code)
+{
+   long i, min = LONG_MAX, len = PStackGetSP(code), sym;
+   int  unit = data->ins_cost;
+   bool bit_parallel = (data->del_cost == unit) &&
+      (data->ch_cost == unit) && (unit > 0) && (len <= LEV_BP_MAX_LEN);
+
+   if(!bit_parallel)
+   {
+      for (i=0; i<data->codes->current; i++) 
+      {
+         min = lev_codes_distance(code,data->codes->stack[i].p_val,
+            data->ins_cost,data->del_cost,data->ch_cost,min);
+      }
+      return min;
+   }
+   for(i=0; i<len; i++)
+   {
+      sym = PStackElementInt(code, i);
+      if(sym != LEV_NO_SYMBOL)
+      {
+         data->peq[sym] |= (uint64_t)1<<i;
+      }
+   }
    for (i=0; i<data->codes->current; i++) 
    {
-      conj_code = data->codes->stack[i].p_val;
-      min = MIN(min,lev_codes_distance(norm_code,conj_code,
-         data->ins_cost,data->del_cost,data->ch_cost));
+      min = lev_codes_distance_bp(data->peq, len,
+                                  data->codes->stack[i].p_val,
+                                  min);
    }
+   for(i=0; i<len; i++)
+   {
+      sym = PStackElementInt(code, i);
+      if(sym != LEV_NO_SYMBOL)
+      {
+         data->peq[sym] = 0;
+      }
+   }
+   return min*unit;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: lev_term_weight()
+//
+//   Return the minimal distance of the normalized term to the
+//   conjecture codes. Results for shared terms are cached (in a
+//   direct-mapped table of bounded size).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes data->cache
+//
+/----------------------------------------------------------------------*/
 
-   PStackFree(norm_code);
-   TermFree(norm);
+static double lev_term_weight(Term_p term, LevWeightParam_p data)
+{
+   double *cached;
+   long   res;
 
-   return min;
+   if (PStackEmpty(data->codes))
+   {
+      return DBL_MAX;
+   }
+   if (TermIsShared(term))
+   {
+      cached = TermWeightMemoFind(data->cache, term);
+      if (cached)
+      {
+         return *cached;
+      }
+   }
+   lev_compute_term_code(data, term, data->term_code, false);
+   res = lev_term_distance(data, data->term_code);
+   if (TermIsShared(term))
+   {
+      *TermWeightMemoStore(data->cache, term) = res;
+   }
+   return res;
 }
 
 /*---------------------------------------------------------------------*/
@@ -311,6 +537,13 @@ LevWeightParam_p LevWeightParamAlloc(void)
    
    res->codes = NULL;
    res->vars  = NULL;
+   res->symbols    = NULL;
+   res->sym_count  = 0;
+   res->peq        = NULL;
+   res->term_code  = NULL;
+   res->trav_stack = NULL;
+   res->norm_vars  = NULL;
+   res->cache      = TermWeightMemoAlloc(TERM_WEIGHT_MEMO_BITS, 1);
    
    return res;
 }
@@ -346,6 +579,15 @@ void LevWeightParamFree(LevWeightParam_p junk)
       VarBankFree(junk->vars);
       junk->vars = NULL;
    }
+   if (junk->symbols)
+   {
+      PDArrayFree(junk->symbols);
+      SizeFree(junk->peq, MAX(junk->sym_count,1)*sizeof(uint64_t));
+      PStackFree(junk->term_code);
+      PStackFree(junk->trav_stack);
+      PStackFree(junk->norm_vars);
+   }
+   TermWeightMemoFree(junk->cache);
    LevWeightParamCellFree(junk);
 }
  
@@ -455,7 +697,8 @@ WFCB_p ConjectureLevDistanceWeightInit(
       pos_multiplier,
       ext_style,
       (TermWeightFun)lev_term_weight,
-      data);
+      data,
+      false);
    
    return WFCBAlloc(
       ConjectureLevDistanceWeightCompute, 
@@ -39,11 +39,19 @@ typedef struct levweightparamcell
    RelatedTermSet rel_terms;
 
    VarBank_p vars;
-   PStack_p codes;
+   PStack_p codes;       /* Conjecture term codes (symbol indices) */
    int ins_cost;
    int del_cost; 
    int ch_cost;
 
+   PDArray_p symbols;    /* Encoded f_code -> symbol index+1 */
+   long      sym_count;  /* Symbols occuring in codes */
+   uint64_t  *peq;       /* Match vectors, one per symbol */
+   PStack_p  term_code;  /* Scratch space for term codes... */
+   PStack_p  trav_stack;
+   PStack_p  norm_vars;
+   TermWeightMemo_p cache; /* Distances of shared terms */
+
    TermWeightExtension_p twe;
    void   (*init_fun)(struct levweightparamcell*);
 }LevWeightParamCell, *LevWeightParam_p;
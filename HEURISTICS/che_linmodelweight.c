@@ -0,0 +1,642 @@
+/*-----------------------------------------------------------------------
+
+File  : che_linmodelweight.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Clause evaluation with a learned linear model over sparse clause
+  features (see che_linmodelweight.h).
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 07:54:13 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "che_linmodelweight.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+#define LM_HASH_MULT     0x9E3779B97F4A7C15ULL
+#define LM_FNV_BASIS     0xCBF29CE484222325ULL
+#define LM_FNV_PRIME     0x100000001B3ULL
+#define LM_INIT_SIZE     16
+
+#define LM_VAR_NAME      "$var"
+#define LM_EQ_NAME       "$eq"
+
+/* Kinds of symbol features, part of the hash key */
+typedef enum
+{
+   LMKSym = 1,
+   LMKPos,
+   LMKNeg,
+   LMKWalk,
+   LMKWalkFrom  /* Marker: There are walks with this parent */
+}LMFeatureKind;
+
+static char* lm_glob_names[] =
+{
+   "bias",
+   "lits",
+   "poslits",
+   "funs",
+   "vars",
+   "depth",
+   NULL
+};
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_name_hash()
+//
+//   Return a (FNV-1a) hash of a symbol name.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static uint64_t lm_name_hash(char* name)
+{
+   uint64_t res = LM_FNV_BASIS;
+
+   for(; *name; name++)
+   {
+      res = (res ^ (unsigned char)*name)*LM_FNV_PRIME;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_key()
+//
+//   Return the (non-zero) key of a symbol feature of the given kind
+//   with symbol name hashes h1 and h2 (0 if unused).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ uint64_t lm_key(LMFeatureKind kind, uint64_t h1,
+                                  uint64_t h2)
+{
+   uint64_t res = (h1^((uint64_t)kind*LM_HASH_MULT))*LM_HASH_MULT;
+
+   res = (res^h2)*LM_HASH_MULT;
+   res = res^(res>>29);
+   return res?res:1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_feature_ref()
+//
+//   Return a pointer to the weight of the feature with the given key,
+//   NULL if the model does not have it.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ double* lm_feature_ref(LinModelParam_p local, uint64_t key)
+{
+   long mask = local->feature_size-1;
+   long i    = (key^(key>>32))&mask;
+
+   while(local->feature_keys[i])
+   {
+      if(local->feature_keys[i] == key)
+      {
+         return &(local->feature_weights[i]);
+      }
+      i = (i+1)&mask;
+   }
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_feature_find()
+//
+//   Return the weight of the feature with the given key, 0 if the
+//   model does not have it.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ double lm_feature_find(LinModelParam_p local, uint64_t key)
+{
+   double *ref = lm_feature_ref(local, key);
+
+   return ref? *ref : 0.0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_array_grow()
+//
+//   Return a copy of the array old (of old_size elements of size
+//   elsize) extended to new_size elements, and free old.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void* lm_array_grow(void* old, long old_size, long new_size,
+                           size_t elsize)
+{
+   void* res = SizeMalloc(new_size*elsize);
+
+   if(old)
+   {
+      memcpy(res, old, old_size*elsize);
+      SizeFree(old, old_size*elsize);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_feature_add()
+//
+//   Add weight to the weight of the feature with the given key.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void lm_feature_add(LinModelParam_p local, uint64_t key, double weight)
+{
+   uint64_t *old_keys    = local->feature_keys;
+   double   *old_weights = local->feature_weights;
+   long     old_size     = local->feature_size, i, mask;
+
+   if(2*(local->feature_no+1) > local->feature_size)
+   {
+      local->feature_size    = 2*old_size;
+      local->feature_keys    = SizeMalloc(local->feature_size*sizeof(uint64_t));
+      local->feature_weights = SizeMalloc(local->feature_size*sizeof(double));
+      local->feature_no      = 0;
+      for(i=0; i<local->feature_size; i++)
+      {
+         local->feature_keys[i] = 0;
+      }
+      for(i=0; i<old_size; i++)
+      {
+         if(old_keys[i])
+         {
+            lm_feature_add(local, old_keys[i], old_weights[i]);
+         }
+      }
+      SizeFree(old_keys, old_size*sizeof(uint64_t));
+      SizeFree(old_weights, old_size*sizeof(double));
+   }
+   mask = local->feature_size-1;
+   for(i = (key^(key>>32))&mask;
+       local->feature_keys[i] && local->feature_keys[i] != key;
+       i = (i+1)&mask)
+   {
+      /* Search */
+   }
+   if(!local->feature_keys[i])
+   {
+      local->feature_keys[i]    = key;
+      local->feature_weights[i] = 0.0;
+      local->feature_no++;
+   }
+   local->feature_weights[i] += weight;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_parse_symbol()
+//
+//   Parse a symbol name and return its hash.
+//
+// Global Variables: -
+//
+// Side Effects    : Input
+//
+/----------------------------------------------------------------------*/
+
+static uint64_t lm_parse_symbol(Scanner_p in)
+{
+   uint64_t res;
+
+   CheckInpTok(in, Identifier|SemIdent|SQString|String|PosInt);
+   res = lm_name_hash(DStrView(AktToken(in)->literal));
+   NextToken(in);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_parse_model()
+//
+//   Parse a model (see che_linmodelweight.h) into local.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void lm_parse_model(LinModelParam_p local, Scanner_p in)
+{
+   LMFeatureKind kind;
+   uint64_t      h1, h2, key = 0;
+   int           glob = -1;
+
+   while(!TestInpTok(in, NoToken))
+   {
+      CheckInpTok(in, Identifier);
+      if(TestInpId(in, "sym|pos|neg|walk"))
+      {
+         kind = TestInpId(in, "sym")?LMKSym:
+            TestInpId(in, "pos")?LMKPos:
+            TestInpId(in, "neg")?LMKNeg:LMKWalk;
+         NextToken(in);
+         AcceptInpTok(in, OpenBracket);
+         h1 = lm_parse_symbol(in);
+         h2 = 0;
+         if(kind == LMKWalk)
+         {
+            AcceptInpTok(in, Comma);
+            h2 = lm_parse_symbol(in);
+            lm_feature_add(local, lm_key(LMKWalkFrom, h1, 0), 0.0);
+         }
+         AcceptInpTok(in, CloseBracket);
+         key  = lm_key(kind, h1, h2);
+         glob = -1;
+      }
+      else
+      {
+         glob = StringIndex(DStrView(AktToken(in)->literal), lm_glob_names);
+         if(glob < 0)
+         {
+            AktTokenError(in, "Unknown model feature", false);
+         }
+         NextToken(in);
+      }
+      AcceptInpTok(in, Colon);
+      if(glob >= 0)
+      {
+         local->glob_weights[glob] += ParseFloat(in);
+      }
+      else
+      {
+         lm_feature_add(local, key, ParseFloat(in));
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_update_symbols()
+//
+//   Make sure the per-symbol weights cover all symbols of the
+//   signature (new symbols are e.g. introduced by splitting).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void lm_update_symbols(LinModelParam_p local)
+{
+   FunCode  i, old_limit = local->f_limit;
+   uint64_t h;
+
+   if(local->sig->f_count < old_limit)
+   {
+      return;
+   }
+   local->f_limit = local->sig->f_count+1;
+   local->f_hash      = lm_array_grow(local->f_hash, old_limit,
+                                      local->f_limit, sizeof(uint64_t));
+   local->sym_weights = lm_array_grow(local->sym_weights, old_limit,
+                                      local->f_limit, sizeof(double));
+   local->pos_weights = lm_array_grow(local->pos_weights, old_limit,
+                                      local->f_limit, sizeof(double));
+   local->neg_weights = lm_array_grow(local->neg_weights, old_limit,
+                                      local->f_limit, sizeof(double));
+   local->walk_from   = lm_array_grow(local->walk_from, old_limit,
+                                      local->f_limit, sizeof(bool));
+   for(i=old_limit; i<local->f_limit; i++)
+   {
+      h = i? lm_name_hash(SigFindName(local->sig, i)) : 0;
+      local->f_hash[i]      = h;
+      local->sym_weights[i] = lm_feature_find(local, lm_key(LMKSym, h, 0));
+      local->pos_weights[i] = lm_feature_find(local, lm_key(LMKPos, h, 0));
+      local->neg_weights[i] = lm_feature_find(local, lm_key(LMKNeg, h, 0));
+      local->walk_from[i]   =
+         lm_feature_ref(local, lm_key(LMKWalkFrom, h, 0)) != NULL;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lm_term_eval()
+//
+//   Return the weighted symbol and walk features of term, add its
+//   symbol and variable occurrences to funs and vars, and set height
+//   to its depth. The values of large shared terms are taken
+//   from/recorded in local->memo.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes local->memo
+//
+/----------------------------------------------------------------------*/
+
+static double lm_term_eval(LinModelParam_p local, Term_p term,
+                           long* funs, long* vars, long* height)
+{
+   double   res, *memo_res;
+   long     t_funs = 1, t_vars = 0, t_height = 0, arg_height;
+   int      i;
+   Term_p   arg;
+   uint64_t h;
+   bool     memoize;
+
+   if(TermIsVar(term))
+   {
+      (*vars)++;
+      *height = 1;
+      return 0.0;
+   }
+   memoize = TermWeightMemoApplies(local->memo, term);
+   if(memoize && (memo_res = TermWeightMemoFind(local->memo, term)))
+   {
+      *funs   += memo_res[1];
+      *vars   += memo_res[2];
+      *height =  memo_res[3];
+      return memo_res[0];
+   }
+   res = local->sym_weights[term->f_code];
+   if(local->walk_from[term->f_code])
+   {
+      h = local->f_hash[term->f_code];
+      for(i=0; i<term->arity; i++)
+      {
+         arg = term->args[i];
+         res += lm_feature_find(local,
+                                lm_key(LMKWalk, h, TermIsVar(arg)?
+                                       local->var_hash:
+                                       local->f_hash[arg->f_code]));
+      }
+   }
+   for(i=0; i<term->arity; i++)
+   {
+      res += lm_term_eval(local, term->args[i], &t_funs, &t_vars,
+                          &arg_height);
+      t_height = MAX(t_height, arg_height);
+   }
+   t_height++;
+   if(memoize)
+   {
+      memo_res = TermWeightMemoStore(local->memo, term);
+      memo_res[0] = res;
+      memo_res[1] = t_funs;
+      memo_res[2] = t_vars;
+      memo_res[3] = t_height;
+   }
+   *funs   += t_funs;
+   *vars   += t_vars;
+   *height =  t_height;
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: LinearModelWeightInit()
+//
+//   Return an initialized WFCB for LinearModelWeight evaluation with
+//   the model read from model_file.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, input
+//
+/----------------------------------------------------------------------*/
+
+WFCB_p LinearModelWeightInit(ClausePrioFun prio_fun, ProofState_p state,
+                             char* model_file)
+{
+   LinModelParam_p local = LinModelParamCellAlloc();
+   Scanner_p       in;
+   long            i;
+
+   local->sig = state->signature;
+   for(i=0; i<LMGlobNo; i++)
+   {
+      local->glob_weights[i] = 0.0;
+   }
+   local->feature_size    = LM_INIT_SIZE;
+   local->feature_no      = 0;
+   local->feature_keys    = SizeMalloc(LM_INIT_SIZE*sizeof(uint64_t));
+   local->feature_weights = SizeMalloc(LM_INIT_SIZE*sizeof(double));
+   for(i=0; i<LM_INIT_SIZE; i++)
+   {
+      local->feature_keys[i] = 0;
+   }
+   local->f_limit     = 0;
+   local->f_hash      = NULL;
+   local->sym_weights = NULL;
+   local->pos_weights = NULL;
+   local->neg_weights = NULL;
+   local->walk_from   = NULL;
+   local->memo        = TermWeightMemoAlloc(TERM_WEIGHT_MEMO_BITS, 4);
+
+   in = CreateScanner(StreamTypeFile, model_file, true, NULL);
+   lm_parse_model(local, in);
+   DestroyScanner(in);
+
+   local->var_hash = lm_name_hash(LM_VAR_NAME);
+   local->eq_pos_weight =
+      lm_feature_find(local, lm_key(LMKPos, lm_name_hash(LM_EQ_NAME), 0));
+   local->eq_neg_weight =
+      lm_feature_find(local, lm_key(LMKNeg, lm_name_hash(LM_EQ_NAME), 0));
+
+   return WFCBAlloc(LinearModelWeightCompute, prio_fun,
+                    LinearModelWeightExit, local);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: LinearModelWeightParse()
+//
+//   Parse a LinearModelWeight-definition:
+//
+//   LinearModelWeight(prio_fun, <model-file>)
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, Input
+//
+/----------------------------------------------------------------------*/
+
+WFCB_p LinearModelWeightParse(Scanner_p in, OCB_p ocb, ProofState_p state)
+{
+   ClausePrioFun prio_fun;
+   char*         model_file;
+   WFCB_p        res;
+
+   AcceptInpTok(in, OpenBracket);
+   prio_fun = ParsePrioFun(in);
+   AcceptInpTok(in, Comma);
+   model_file = ParseFilename(in);
+   AcceptInpTok(in, CloseBracket);
+
+   res = LinearModelWeightInit(prio_fun, state, model_file);
+   FREE(model_file);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: LinearModelWeightCompute()
+//
+//   Compute the model evaluation of clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations (for new symbols), changes
+//                   the memo
+//
+/----------------------------------------------------------------------*/
+
+double LinearModelWeightCompute(void* data, Clause_p clause)
+{
+   LinModelParam_p local = data;
+   Eqn_p           handle;
+   long            lits = 0, poslits = 0, funs = 0, vars = 0, depth = 0;
+   long            height;
+   double          res = 0.0;
+
+   lm_update_symbols(local);
+
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      lits++;
+      if(EqnIsPositive(handle))
+      {
+         poslits++;
+         res += EqnIsEquLit(handle)? local->eq_pos_weight :
+            local->pos_weights[handle->lterm->f_code];
+      }
+      else
+      {
+         res += EqnIsEquLit(handle)? local->eq_neg_weight :
+            local->neg_weights[handle->lterm->f_code];
+      }
+      res += lm_term_eval(local, handle->lterm, &funs, &vars, &height);
+      depth = MAX(depth, height);
+      if(EqnIsEquLit(handle))
+      {
+         funs++; /* Count the equal-predicate */
+         res += lm_term_eval(local, handle->rterm, &funs, &vars, &height);
+         depth = MAX(depth, height);
+      }
+   }
+   res += local->glob_weights[LMBias] +
+      local->glob_weights[LMLits]*lits +
+      local->glob_weights[LMPosLits]*poslits +
+      local->glob_weights[LMFuns]*funs +
+      local->glob_weights[LMVars]*vars +
+      local->glob_weights[LMDepth]*depth;
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: LinearModelWeightExit()
+//
+//   Free the data of a LinearModelWeight WFCB.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void LinearModelWeightExit(void* data)
+{
+   LinModelParam_p junk = data;
+
+   TermWeightMemoFree(junk->memo);
+   SizeFree(junk->feature_keys, junk->feature_size*sizeof(uint64_t));
+   SizeFree(junk->feature_weights, junk->feature_size*sizeof(double));
+   if(junk->f_limit)
+   {
+      SizeFree(junk->f_hash, junk->f_limit*sizeof(uint64_t));
+      SizeFree(junk->sym_weights, junk->f_limit*sizeof(double));
+      SizeFree(junk->pos_weights, junk->f_limit*sizeof(double));
+      SizeFree(junk->neg_weights, junk->f_limit*sizeof(double));
+      SizeFree(junk->walk_from, junk->f_limit*sizeof(bool));
+   }
+   LinModelParamCellFree(junk);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,118 @@
+/*-----------------------------------------------------------------------
+
+File  : che_linmodelweight.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Clause evaluation with a learned linear model over sparse clause
+  features. The model is read from a file of entries
+
+    <feature> : <weight>
+
+  (comments start with # or %), where a feature is one of
+
+    bias          constant 1
+    lits          number of literals
+    poslits       number of positive literals
+    funs          number of function/predicate symbol occurrences
+                  (including equality, but not $true)
+    vars          number of variable occurrences
+    depth         maximal term depth
+    sym(f)        occurrences of symbol f
+    pos(p)        positive literals with predicate p
+    neg(p)        negative literals with predicate p
+    walk(f, g)    occurrences of g as an argument of f
+
+  Symbols are given by name. $var stands for any variable (in walks)
+  and $eq for the equality predicate (in pos/neg). The evaluation of a
+  clause is the sum of the weights of its features times their
+  values, so with "funs : 2" and "vars : 1" and nothing else, the
+  model is equivalent to Clauseweight(_, 2, 1, 1) on first-order
+  problems. Features not in the model have weight 0.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 07:54:13 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CHE_LINMODELWEIGHT
+
+#define CHE_LINMODELWEIGHT
+
+#include <che_wfcb.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+typedef enum
+{
+   LMBias,
+   LMLits,
+   LMPosLits,
+   LMFuns,
+   LMVars,
+   LMDepth,
+   LMGlobNo
+}LMGlobFeature;
+
+typedef struct linmodelparamcell
+{
+   Sig_p    sig;
+   double   glob_weights[LMGlobNo];
+   /* Symbol features of the model, hashed by kind and symbol names
+      (open addressing, keys are never 0) */
+   long     feature_size;
+   long     feature_no;
+   uint64_t *feature_keys;
+   double   *feature_weights;
+   uint64_t var_hash;
+   double   eq_pos_weight;
+   double   eq_neg_weight;
+   /* Per-symbol weights, valid for f_codes < f_limit */
+   FunCode  f_limit;
+   uint64_t *f_hash;
+   double   *sym_weights;
+   double   *pos_weights;
+   double   *neg_weights;
+   bool     *walk_from;   /* Model has walks with this parent */
+   /* Features of large shared terms: Score, symbol and variable
+      occurrences, depth */
+   TermWeightMemo_p memo;
+}LinModelParamCell, *LinModelParam_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define LinModelParamCellAlloc() (LinModelParamCell*) \
+        SizeMalloc(sizeof(LinModelParamCell))
+#define LinModelParamCellFree(junk) \
+        SizeFree(junk, sizeof(LinModelParamCell))
+
+WFCB_p LinearModelWeightInit(ClausePrioFun prio_fun, ProofState_p state,
+                             char* model_file);
+
+WFCB_p LinearModelWeightParse(Scanner_p in, OCB_p ocb, ProofState_p state);
+
+double LinearModelWeightCompute(void* data, Clause_p clause);
+
+void   LinearModelWeightExit(void* data);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -420,10 +420,10 @@ static Eqn_p find_smallest_max_neg_ground_lit(Clause_p clause)
     /* assert(EqnIsOriented(handle)); Only true if we don't run
           * into LPORecursionDepthLimit */
 
-    if(handle->lterm->weight < select_weight)
+    if(TermCellWeight(handle->lterm) < select_weight)
     {
        selected = handle;
-       select_weight = handle->lterm->weight;
+       select_weight = TermCellWeight(handle->lterm);
     }
       }
       handle = handle->next;
@@ -499,7 +499,7 @@ static Eqn_p find_max_xtype_no_type_lit(Clause_p clause)
       {
     assert(EqnIsOriented(handle));
 
-    weight = handle->lterm->weight;
+    weight = TermCellWeight(handle->lterm);
     if(weight > select_weight)
     {
        select_weight = weight;
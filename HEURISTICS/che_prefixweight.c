@@ -374,7 +374,8 @@ WFCB_p ConjectureTermPrefixWeightInit(
       pos_multiplier,
       ext_style,
       (TermWeightFun)prfx_term_weight,
-      data);
+      data,
+      true);
    
    return WFCBAlloc(
       ConjectureTermPrefixWeightCompute, 
@@ -20,6 +20,8 @@ Changes
     Salvaged from cco_proofstate.h, forked control and state.
 <2> Wed Dec 16 18:45:14 MET 1998
     Moved from cco to che
+<3> Mon Oct 19 08:12:06 CEST 2026
+    Time literal selection
 
 -----------------------------------------------------------------------*/
 
@@ -32,6 +34,8 @@ Changes
 
 #define CHE_PROOFCONTROL_INTERNAL
 
+PERF_CTR_DEFINE(LitSelTimer);
+
 char* DefaultWeightFunctions =
 "\n"
 "weight21_ugg  = Clauseweight(PreferUnitGroundGoals,2,1,1)      \n"
@@ -181,6 +185,58 @@ void sat_solver_init(ProofControl_p ctrl)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: do_literal_selection()
+//
+//   Select literals in clause as described for DoLiteralSelection().
+//
+// Global Variables: -
+//
+// Side Effects    : Changes properties in clause
+//
+/----------------------------------------------------------------------*/
+
+static void do_literal_selection(ProofControl_p control, Clause_p clause)
+{
+   EqnListDelProp(clause->literals, EPIsSelected);
+   assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
+   ClauseDelProp(clause, CPIsOriented);
+   assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
+
+   if(control->heuristic_parms.inherit_paramod_lit||
+      (control->heuristic_parms.inherit_goal_pm_lit&&ClauseIsGoal(clause))||
+      (control->heuristic_parms.inherit_conj_pm_lit&&ClauseIsConjecture(clause))
+      )
+   {
+      if(select_inherited_literal(clause))
+      {
+    return;
+      }
+   }
+   if(clause->neg_lit_no &&
+      (clause->pos_lit_no >= control->heuristic_parms.pos_lit_sel_min) &&
+      (clause->pos_lit_no <= control->heuristic_parms.pos_lit_sel_max) &&
+      (clause->neg_lit_no >= control->heuristic_parms.neg_lit_sel_min) &&
+      (clause->neg_lit_no <= control->heuristic_parms.neg_lit_sel_max) &&
+      (ClauseLiteralNumber(clause) >= control->heuristic_parms.all_lit_sel_min) &&
+      (ClauseLiteralNumber(clause) <= control->heuristic_parms.all_lit_sel_max) &&
+      ((control->heuristic_parms.weight_sel_min==0) || /* Efficiency hack - only
+                 compute clause weight if this
+                 option is activated */
+       (control->heuristic_parms.weight_sel_min<=ClauseStandardWeight(clause))))
+   {
+      assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
+      control->heuristic_parms.selection_strategy(control->ocb,clause);
+   }
+   else
+   {
+      assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
+      SelectNoLiterals(control->ocb,clause);
+   }
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -279,41 +335,9 @@ void ProofControlResetSATSolver(ProofControl_p ctrl)
 
 void DoLiteralSelection(ProofControl_p control, Clause_p clause)
 {
-   EqnListDelProp(clause->literals, EPIsSelected);
-   assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
-   ClauseDelProp(clause, CPIsOriented);
-   assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
-
-   if(control->heuristic_parms.inherit_paramod_lit||
-      (control->heuristic_parms.inherit_goal_pm_lit&&ClauseIsGoal(clause))||
-      (control->heuristic_parms.inherit_conj_pm_lit&&ClauseIsConjecture(clause))
-      )
-   {
-      if(select_inherited_literal(clause))
-      {
-    return;
-      }
-   }
-   if(clause->neg_lit_no &&
-      (clause->pos_lit_no >= control->heuristic_parms.pos_lit_sel_min) &&
-      (clause->pos_lit_no <= control->heuristic_parms.pos_lit_sel_max) &&
-      (clause->neg_lit_no >= control->heuristic_parms.neg_lit_sel_min) &&
-      (clause->neg_lit_no <= control->heuristic_parms.neg_lit_sel_max) &&
-      (ClauseLiteralNumber(clause) >= control->heuristic_parms.all_lit_sel_min) &&
-      (ClauseLiteralNumber(clause) <= control->heuristic_parms.all_lit_sel_max) &&
-      ((control->heuristic_parms.weight_sel_min==0) || /* Efficiency hack - only
-                 compute clause weight if this
-                 option is activated */
-       (control->heuristic_parms.weight_sel_min<=ClauseStandardWeight(clause))))
-   {
-      assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
-      control->heuristic_parms.selection_strategy(control->ocb,clause);
-   }
-   else
-   {
-      assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
-      SelectNoLiterals(control->ocb,clause);
-   }
+   PERF_CTR_ENTRY(LitSelTimer);
+   do_literal_selection(control, clause);
+   PERF_CTR_EXIT(LitSelTimer);
 }
 
 /*---------------------------------------------------------------------*/
@@ -60,6 +60,8 @@ typedef HCB_p (*HCBCreateFun)(HCBARGUMENTS);
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+PERF_CTR_DECL(LitSelTimer);
+
 extern  char* DefaultWeightFunctions;
 extern  char* DefaultHeuristics;
 
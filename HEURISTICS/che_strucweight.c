@@ -466,7 +466,8 @@ WFCB_p ConjectureStrucDistanceWeightInit(
       pos_multiplier,
       ext_style,
       (TermWeightFun)strc_term_weight,
-      data);
+      data,
+      true);
    
    return WFCBAlloc(
       ConjectureStrucDistanceWeightCompute, 
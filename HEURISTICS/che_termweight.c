@@ -460,7 +460,8 @@ WFCB_p ConjectureRelativeTermWeightInit(
       pos_multiplier,
       ext_style,
       (TermWeightFun)termweight_term_weight,
-      data);
+      data,
+      false);
    
    return WFCBAlloc(
       ConjectureRelativeTermWeightCompute, 
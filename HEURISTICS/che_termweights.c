@@ -443,31 +443,22 @@ void TBIncSubtermsFreqs(Term_p term, NumTree_p* freqs)
 
 NumTree_p TBCountTermFreqs(TB_p bank)
 {
-   PStack_p stack = PStackAlloc();
    Term_p term;
-   int i;
+   long i;
    NumTree_p freqs = NULL;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
-   {      
-      PStackPushP(stack, bank->term_store.store[i]);
-      while(!PStackEmpty(stack))
+   for(i=0; i<TermCellStoreSize(&(bank->term_store)); i++)
+   {
+      for(term = TermCellStoreBucket(&(bank->term_store), i);
+          term;
+          term = term->chain)
       {
-         term = PStackPopP(stack);
-         if ((!term) || (!TermCellQueryProp(term,TPTopPos)))
-         {
-            continue;
-         }
-         TBIncSubtermsFreqs(term, &freqs);
-         if(term)
+         if(TermCellQueryProp(term,TPTopPos))
          {
-            PStackPushP(stack, term->lson);
-            PStackPushP(stack, term->rson);
+            TBIncSubtermsFreqs(term, &freqs);
          }
       }
    }
-   PStackFree(stack);
-
    return freqs;
 }
 
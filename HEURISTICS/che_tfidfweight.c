@@ -346,7 +346,8 @@ WFCB_p ConjectureTermTfIdfWeightInit(
       pos_multiplier,
       ext_style,
       (TermWeightFun)tfidf_term_weight,
-      data);
+      data,
+      false);
    
    return WFCBAlloc(
       ConjectureTermTfIdfWeightCompute, 
@@ -18,10 +18,13 @@ Changes
 
 <1> Fri Jan  1 16:06:31 MET 1999
     New
+<2> Mon Oct 19 09:11:46 CEST 2026
+    Auto orderings are selected from class tables
 
 -----------------------------------------------------------------------*/
 
 #include "che_to_autoselect.h"
+#include "che_autotables.h"
 
 
 
@@ -39,8 +42,6 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
-#define TO_ORDERING_INTERNAL
-
 /*-----------------------------------------------------------------------
 //
 // Function: init_oparms()
@@ -94,6 +95,29 @@ void print_oparms(OrderParms_p oparms)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: auto_select_oparms()
+//
+//   Classify the proof problem with the auto-mode table for mode and
+//   set the ordering parameters of the selected case in oparms.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, calls SpecFeaturesAddEval()
+//                   and changes cheap parts of specs.
+//
+/----------------------------------------------------------------------*/
+
+static void auto_select_oparms(char* mode, SpecFeature_p spec,
+                               SpecLimits_p limits, OrderParms_p oparms)
+{
+   AutoTable_p table = AutoTableGet(mode);
+
+   AutoCaseApplyOrderParms(AutoTableClassify(table, spec, limits), oparms);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: generate_auto_ordering()
@@ -107,14 +131,6 @@ void print_oparms(OrderParms_p oparms)
 //
 /----------------------------------------------------------------------*/
 
-#define CHE_HEURISTICS_AUTO
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_auto_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -122,13 +138,11 @@ OCB_p generate_auto_ordering(ProofState_p state, SpecFeature_p spec)
 
    init_oparms(&oparms);
    OUTPRINT(1, "\n# Auto-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("Auto", spec, limits, &oparms);
    print_oparms(&oparms);
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO
 
 
 /*-----------------------------------------------------------------------
@@ -145,14 +159,6 @@ GCC_DIAGNOSTIC_POP
 //
 /----------------------------------------------------------------------*/
 
-#define CHE_HEURISTICS_AUTO_CASC
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autocasc_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -182,7 +188,7 @@ OCB_p generate_autocasc_ordering(ProofState_p state, SpecFeature_p spec)
    oparms.no_lit_cmp      = false;
    OUTPRINT(1, "\n# Auto-Ordering is analysing problem.\n");
 
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoCASC", spec, limits, &oparms);
 
    if(OutputLevel)
    {
@@ -200,8 +206,6 @@ OCB_p generate_autocasc_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_CASC
 
 
 
@@ -218,14 +222,6 @@ GCC_DIAGNOSTIC_POP
 //
 /----------------------------------------------------------------------*/
 
-#define CHE_HEURISTICS_AUTO_DEV
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autodev_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -238,7 +234,7 @@ OCB_p generate_autodev_ordering(ProofState_p state, SpecFeature_p spec)
    oparms.no_lit_cmp      = false;
 
    OUTPRINT(1, "\n# Auto-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoDev", spec, limits, &oparms);
 
    if(OutputLevel)
    {
@@ -256,8 +252,6 @@ OCB_p generate_autodev_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_DEV
 
 
 /*-----------------------------------------------------------------------
@@ -281,14 +275,6 @@ GCC_DIAGNOSTIC_POP
 //
 /----------------------------------------------------------------------*/
 
-#define CHE_HEURISTICS_AUTO_SCHED0
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched0_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -296,22 +282,12 @@ OCB_p generate_autosched0_ordering(ProofState_p state, SpecFeature_p spec)
 
    init_oparms(&oparms);
    OUTPRINT(1, "\n# AutoSched0-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoSched0", spec, limits, &oparms);
    print_oparms(&oparms);
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED0
-
-#define CHE_HEURISTICS_AUTO_SCHED1
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched1_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -319,22 +295,12 @@ OCB_p generate_autosched1_ordering(ProofState_p state, SpecFeature_p spec)
 
    init_oparms(&oparms);
    OUTPRINT(1, "\n# AutoSched1-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoSched1", spec, limits, &oparms);
    print_oparms(&oparms);
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED1
-
-#define CHE_HEURISTICS_AUTO_SCHED2
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched2_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -342,22 +308,12 @@ OCB_p generate_autosched2_ordering(ProofState_p state, SpecFeature_p spec)
 
    init_oparms(&oparms);
    OUTPRINT(1, "\n# AutoSched2-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoSched2", spec, limits, &oparms);
    print_oparms(&oparms);
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED2
-
-#define CHE_HEURISTICS_AUTO_SCHED3
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched3_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -365,22 +321,12 @@ OCB_p generate_autosched3_ordering(ProofState_p state, SpecFeature_p spec)
 
    init_oparms(&oparms);
    OUTPRINT(1, "\n# AutoSched3-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoSched3", spec, limits, &oparms);
    print_oparms(&oparms);
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED3
-
-#define CHE_HEURISTICS_AUTO_SCHED4
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched4_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -388,22 +334,12 @@ OCB_p generate_autosched4_ordering(ProofState_p state, SpecFeature_p spec)
 
    init_oparms(&oparms);
    OUTPRINT(1, "\n# AutoSched4-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoSched4", spec, limits, &oparms);
    print_oparms(&oparms);
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED4
 
-#define CHE_HEURISTICS_AUTO_SCHED5
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched5_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -411,22 +347,12 @@ OCB_p generate_autosched5_ordering(ProofState_p state, SpecFeature_p spec)
 
    init_oparms(&oparms);
    OUTPRINT(1, "\n# AutoSched5-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoSched5", spec, limits, &oparms);
    print_oparms(&oparms);
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED5
 
-#define CHE_HEURISTICS_AUTO_SCHED6
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched6_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -434,22 +360,12 @@ OCB_p generate_autosched6_ordering(ProofState_p state, SpecFeature_p spec)
 
    init_oparms(&oparms);
    OUTPRINT(1, "\n# AutoSched6-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoSched6", spec, limits, &oparms);
    print_oparms(&oparms);
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED6
 
-#define CHE_HEURISTICS_AUTO_SCHED7
-
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched7_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -457,13 +373,11 @@ OCB_p generate_autosched7_ordering(ProofState_p state, SpecFeature_p spec)
 
    init_oparms(&oparms);
    OUTPRINT(1, "\n# AutoSched7-Ordering is analysing problem.\n");
-#include "che_auto_cases.c"
+   auto_select_oparms("AutoSched7", spec, limits, &oparms);
    print_oparms(&oparms);
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
-#undef CHE_HEURISTICS_AUTO_SCHED67
 
 
 
@@ -985,7 +899,6 @@ OCB_p  TOCreateOrdering(ProofState_p state, OrderParms_p params,
    return handle;
 }
 
-#undef TO_ORDERING_INTERNAL
 
 
 /*---------------------------------------------------------------------*/
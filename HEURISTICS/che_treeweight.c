@@ -64,23 +64,452 @@
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
-static void ted_insert_term(
-   PStack_p terms,
+/* Symbol index for symbols that do not occur in any conjecture term */
+#define TED_NO_SYMBOL -1
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_symbol()
+//
+//   Return the symbol index of f_code (a function symbol or a
+//   normalized variable). If extend is true, unknown symbols get a new
+//   index, otherwise TED_NO_SYMBOL is returned for them.
+//
+// Global Variables: -
+//
+// Side Effects    : May extend data->symbols
+//
+/----------------------------------------------------------------------*/
+
+static long ted_symbol(TreeWeightParam_p data, FunCode f_code, bool extend)
+{
+   long key = (f_code >= 0)? 2*f_code : -2*f_code+1;
+   long res = PDArrayElementInt(data->symbols, key);
+
+   if(!res)
+   {
+      if(!extend)
+      {
+         return TED_NO_SYMBOL;
+      }
+      res = ++(data->sym_count);
+      PDArrayAssignInt(data->symbols, key, res);
+   }
+   return res-1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_norm_var()
+//
+//   Return the f_code of var after variable normalization in the
+//   style of TermCopyNormalizeVars(). Variables are leaves, so
+//   visiting them in postorder gives the same order of first
+//   occurences as the preorder used there.
+//
+// Global Variables: -
+//
+// Side Effects    : May change data->norm_vars
+//
+/----------------------------------------------------------------------*/
+
+static FunCode ted_norm_var(TreeWeightParam_p data, Term_p var)
+{
+   PStackPointer i;
+
+   switch(data->var_norm)
+   {
+   case NSUnivar:
+         return -2;
+   case NSAlpha:
+         for(i=0; i<PStackGetSP(data->norm_vars); i++)
+         {
+            if(PStackElementInt(data->norm_vars, i) == var->f_code)
+            {
+               break;
+            }
+         }
+         if(i == PStackGetSP(data->norm_vars))
+         {
+            PStackPushInt(data->norm_vars, var->f_code);
+         }
+         return -2*(i+1);
+   default:
+         return var->f_code;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_tree_alloc()
+//
+//   Allocate an empty tree with space for size-1 nodes.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static TedTree_p ted_tree_alloc(long size)
+{
+   TedTree_p tree = TedTreeCellAlloc();
+
+   tree->len      = 0;
+   tree->size     = size;
+   tree->lml      = SizeMalloc(size*sizeof(long));
+   tree->code     = SizeMalloc(size*sizeof(long));
+   tree->kr_no    = 0;
+   tree->keyroots = SizeMalloc(size*sizeof(long));
+   tree->hist_no  = 0;
+   tree->hist     = NULL;
+
+   return tree;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_tree_free()
+//
+//   Free a tree.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void ted_tree_free(TedTree_p junk)
+{
+   SizeFree(junk->lml, junk->size*sizeof(long));
+   SizeFree(junk->code, junk->size*sizeof(long));
+   SizeFree(junk->keyroots, junk->size*sizeof(long));
+   if(junk->hist)
+   {
+      SizeFree(junk->hist, 2*junk->hist_no*sizeof(long));
+   }
+   TedTreeCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_lmld_kr()
+//
+//   Number the nodes of term in postorder (starting at *fresh), and
+//   record leftmost leaves, codes and keyroots in tree. Return the
+//   number of the leftmost leaf of term.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, see ted_symbol()
+//
+/----------------------------------------------------------------------*/
+
+static long ted_lmld_kr(
+   TreeWeightParam_p data,
    Term_p term, 
-   VarBank_p vars, 
-   VarNormStyle var_norm)
+   TedTree_p tree,
+   long* fresh, 
+   bool isroot,
+   bool extend)
 {
-   Term_p norm;
-   
-   norm = TermCopyNormalizeVars(vars,term,var_norm);
-   PStackPushP(terms,norm);
+   int i;
+   long idx, lidx;
+   FunCode f_code = term->f_code;
+
+   if (TermIsVar(term)||TermIsConst(term)) 
+   {
+      idx = (*fresh)++;
+      tree->lml[idx] = idx;
+      lidx = idx;
+      if (TermIsVar(term))
+      {
+         f_code = ted_norm_var(data, term);
+      }
+   }
+   else 
+   {
+      lidx = ted_lmld_kr(data,term->args[0],tree,fresh,false,extend);
+      for (i=1; i<term->arity; i++)
+      {
+         ted_lmld_kr(data,term->args[i],tree,fresh,true,extend);
+      }
+
+      idx = (*fresh)++;
+      tree->lml[idx] = tree->lml[lidx];
+   }
+
+   tree->code[idx] = ted_symbol(data, f_code, extend);
+   if (isroot) 
+   {
+      tree->keyroots[tree->kr_no++] = idx;
+   }
+   return lidx;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_tree_compute()
+//
+//   Fill tree (reallocating it if necessary) with the variable
+//   normalized version of term. Returns tree.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static TedTree_p ted_tree_compute(TreeWeightParam_p data, Term_p term,
+                                  TedTree_p tree, bool extend)
+{
+   long len = TermWeight(term,1,1), fresh = 1;
+
+   if (!tree || tree->size < len+1)
+   {
+      if (tree)
+      {
+         ted_tree_free(tree);
+      }
+      tree = ted_tree_alloc(len+1);
+   }
+   tree->len = len;
+   tree->kr_no = 0;
+   PStackReset(data->norm_vars);
+   ted_lmld_kr(data,term,tree,&fresh,true,extend);
+   assert(fresh == len+1);
+
+   return tree;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_cmp_long()
+//
+//   Comparison function for qsort().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int ted_cmp_long(const void* p1, const void* p2)
+{
+   const long *l1 = p1, *l2 = p2;
+
+   return (*l1 > *l2) - (*l1 < *l2);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_tree_add_hist()
+//
+//   Compute the symbol histogram of a (conjecture) tree.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void ted_tree_add_hist(TedTree_p tree)
+{
+   long sorted[tree->len];
+   long i, j;
+
+   for (i=0; i<tree->len; i++)
+   {
+      sorted[i] = tree->code[i+1];
+   }
+   qsort(sorted, tree->len, sizeof(long), ted_cmp_long);
+   tree->hist_no = 0;
+   for (i=0; i<tree->len; i++)
+   {
+      if (!i || sorted[i] != sorted[i-1])
+      {
+         tree->hist_no++;
+      }
+   }
+   tree->hist = SizeMalloc(2*tree->hist_no*sizeof(long));
+   for (i=0, j=-1; i<tree->len; i++)
+   {
+      if (!i || sorted[i] != sorted[i-1])
+      {
+         j++;
+         tree->hist[2*j]   = sorted[i];
+         tree->hist[2*j+1] = 0;
+      }
+      tree->hist[2*j+1]++;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_lower_bound()
+//
+//   Return a lower bound for the distance of the current term
+//   (whose histogram is in data->hist) to tree. A mapping of k nodes
+//   leaves len1-k deletions and len2-k insertions, and at most
+//   "common" (the size of the multiset intersection of the labels) of
+//   the mapped nodes can have equal labels.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long ted_lower_bound(TreeWeightParam_p data, TedTree_p query,
+                            TedTree_p tree)
+{
+   long i, common = 0;
+   long mapped = MIN(query->len, tree->len);
+   long res;
+
+   for (i=0; i<tree->hist_no; i++)
+   {
+      common += MIN(tree->hist[2*i+1], data->hist[tree->hist[2*i]]);
+   }
+   res = data->del_cost*(query->len-common)+
+      data->ins_cost*(tree->len-common);
+   return MIN(res,
+              data->del_cost*(query->len-mapped)+
+              data->ins_cost*(tree->len-mapped)+
+              data->ch_cost*(mapped-common));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_forest_distance()
+//
+//   Compute the forest distances for the keyroots i of t1 and j of
+//   t2, storing tree distances in the (t1->len+1)x(t2->len+1) matrix
+//   data->td. The forest distance matrix only covers the rows and
+//   columns of the two subtrees.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes data->td, data->fd
+//
+/----------------------------------------------------------------------*/
+
+static void ted_forest_distance(
+   TreeWeightParam_p data,
+   TedTree_p t1,
+   TedTree_p t2,
+   long i, 
+   long j)
+{
+   long *l1 = t1->lml, *l2 = t2->lml, *code1 = t1->code, *code2 = t2->code;
+   long li = l1[i]-1, lj = l2[j]-1;
+   long cols = j-lj+1, tdcols = t2->len+1;
+   long *td = data->td, *fd = data->fd;
+   long di, dj;
+   int  ins_cost = data->ins_cost, del_cost = data->del_cost;
+   int  ch_cost = data->ch_cost;
+
+#define FD(x,y) fd[((x)-li)*cols+((y)-lj)]
+#define TD(x,y) td[(x)*tdcols+(y)]
+
+   FD(li,lj) = 0;
+   for (di=li+1; di<=i; di++) 
+   {
+      FD(di,lj) = FD(di-1,lj)+del_cost;
+   }
+   for (dj=lj+1; dj<=j; dj++) 
+   {
+      FD(li,dj) = FD(li,dj-1)+ins_cost;
+   }
+   for (di=li+1; di<=i; di++)
+   {
+      for (dj=lj+1; dj<=j; dj++)
+      {
+         if ((l1[di]==l1[i]) && (l2[dj]==l2[j]))
+         {
+            FD(di,dj) = MIN3(
+               FD(di-1,dj)+del_cost,
+               FD(di,dj-1)+ins_cost,
+               FD(di-1,dj-1)+(code1[di]==code2[dj]?0:ch_cost));
+            TD(di,dj) = FD(di,dj);
+         }
+         else
+         {
+            FD(di,dj) = MIN3(
+               FD(di-1,dj)+del_cost,
+               FD(di,dj-1)+ins_cost,
+               FD(l1[di]-1,l2[dj]-1)+TD(di,dj));
+         }
+      }
+   }
+#undef FD
+#undef TD
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ted_term_distance()
+//
+//   Return the tree edit distance between t1 and t2 (Zhang-Shasha).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long ted_term_distance(TreeWeightParam_p data, TedTree_p t1,
+                              TedTree_p t2)
+{
+   long size = (t1->len+1)*(t2->len+1);
+   long x, y;
+
+   if (size > data->td_size)
+   {
+      if (data->td)
+      {
+         SizeFree(data->td, data->td_size*sizeof(long));
+         SizeFree(data->fd, data->fd_size*sizeof(long));
+      }
+      data->td_size = data->fd_size = MAX(size, 2*data->td_size);
+      data->td = SizeMalloc(data->td_size*sizeof(long));
+      data->fd = SizeMalloc(data->fd_size*sizeof(long));
+   }
+   for (x=0; x<t1->kr_no; x++) 
+   {
+      for (y=0; y<t2->kr_no; y++)
+      {
+         ted_forest_distance(data, t1, t2,
+                             t1->keyroots[x], t2->keyroots[y]);
+      }
+   }
+   return data->td[t1->len*(t2->len+1)+t2->len];
+}
+
+
+static void ted_insert_term(
+   TreeWeightParam_p data,
+   Term_p term)
+{
+   TedTree_p tree = ted_tree_compute(data, term, NULL, true);
+
+   ted_tree_add_hist(tree);
+   PStackPushP(data->terms, tree);
 }
 
 static void ted_insert_subterms(
-   PStack_p terms,
-   Term_p term, 
-   VarBank_p vars, 
-   VarNormStyle var_norm)
+   TreeWeightParam_p data,
+   Term_p term)
 {
    int i;
    PStack_p stack;
@@ -95,7 +524,7 @@ static void ted_insert_subterms(
       if(TermIsVar(subterm)) {
          continue;
       }
-      ted_insert_term(terms,subterm,vars,var_norm);
+      ted_insert_term(data,subterm);
 
       for(i=0; i<subterm->arity; i++)
       {
@@ -107,38 +536,33 @@ static void ted_insert_subterms(
 }
 
 static void ted_insert_topgens(
-   PStack_p terms, 
-   Term_p term, 
-   VarBank_p vars,
-   Sig_p sig,
-   VarNormStyle var_norm)
+   TreeWeightParam_p data,
+   Term_p term)
 {
    int i;
    PStack_p topgens;
    Term_p topgen;
 
-   topgens = ComputeTopGeneralizations(term,vars,sig);
+   topgens = ComputeTopGeneralizations(term,data->vars,data->ocb->sig);
    for (i=0; i<topgens->current; i++) {
       topgen = topgens->stack[i].p_val;
-      ted_insert_term(terms,topgen,vars,var_norm);
+      ted_insert_term(data,topgen);
    }
    FreeGeneralizations(topgens);
 }
 
 static void ted_insert_subgens(
-   PStack_p terms, 
-   Term_p term, 
-   VarBank_p vars, 
-   VarNormStyle var_norm)
+   TreeWeightParam_p data,
+   Term_p term)
 {
    int i;
    PStack_p subgens;
    Term_p genterm;
 
-   subgens = ComputeSubtermsGeneralizations(term,vars);
+   subgens = ComputeSubtermsGeneralizations(term,data->vars);
    for (i=0; i<subgens->current; i++) {
       genterm = subgens->stack[i].p_val;
-      ted_insert_term(terms,genterm,vars,var_norm);
+      ted_insert_term(data,genterm);
    }
    FreeGeneralizations(subgens);
 }
@@ -156,6 +580,8 @@ static void ted_init(TreeWeightParam_p data)
 
    data->terms = PStackAlloc();
    data->vars = VarBankAlloc(data->proofstate->signature->type_bank);
+   data->symbols = PDIntArrayAlloc(64, 0);
+   data->norm_vars = PStackAlloc();
    
    // for each axiom ...
    anchor = data->proofstate->axioms->anchor;
@@ -170,32 +596,22 @@ static void ted_init(TreeWeightParam_p data)
       {
          switch (data->rel_terms) {
          case RTSConjectureTerms:
-            ted_insert_term(
-               data->terms,lit->lterm,data->vars,data->var_norm);
-            ted_insert_term(
-               data->terms,lit->rterm,data->vars,data->var_norm);
+            ted_insert_term(data,lit->lterm);
+            ted_insert_term(data,lit->rterm);
             break;
          case RTSConjectureSubterms:
-            ted_insert_subterms(
-               data->terms,lit->lterm,data->vars,data->var_norm);
-            ted_insert_subterms(
-               data->terms,lit->rterm,data->vars,data->var_norm);
+            ted_insert_subterms(data,lit->lterm);
+            ted_insert_subterms(data,lit->rterm);
             break;
          case RTSConjectureSubtermsTopGens:
-            ted_insert_subterms(
-               data->terms,lit->lterm,data->vars,data->var_norm);
-            ted_insert_subterms(
-               data->terms,lit->rterm,data->vars,data->var_norm);
-            ted_insert_topgens(data->terms,lit->lterm,data->vars,
-               data->ocb->sig,data->var_norm);
-            ted_insert_topgens(data->terms,lit->rterm,data->vars,
-               data->ocb->sig,data->var_norm);
+            ted_insert_subterms(data,lit->lterm);
+            ted_insert_subterms(data,lit->rterm);
+            ted_insert_topgens(data,lit->lterm);
+            ted_insert_topgens(data,lit->rterm);
             break;
          case RTSConjectureSubtermsAllGens:
-            ted_insert_subgens(
-               data->terms,lit->lterm,data->vars,data->var_norm);
-            ted_insert_subgens(
-               data->terms,lit->rterm,data->vars,data->var_norm);
+            ted_insert_subgens(data,lit->lterm);
+            ted_insert_subgens(data,lit->rterm);
             break;
          default:
             Error("ConjectureTreeDistanceWeight parameters usage error (unsupported RelatedTermSet %d)", USAGE_ERROR, data->rel_terms);
@@ -203,179 +619,72 @@ static void ted_init(TreeWeightParam_p data)
          }
       }
    }
+   data->hist = SizeMalloc(MAX(data->sym_count,1)*sizeof(long));
+   memset(data->hist, 0, MAX(data->sym_count,1)*sizeof(long));
 }
 
-static void ted_forest_distance(
-   long i, 
-   long j, 
-   long* l1, 
-   long* l2, 
-   FunCode* code1,
-   FunCode* code2,
-   int len2,
-   long td[][len2],
-   int ins_cost, 
-   int del_cost, 
-   int ch_cost)
+/*-----------------------------------------------------------------------
+//
+// Function: ted_term_weight()
+//
+//   Return the minimal tree edit distance of the normalized term to
+//   the conjecture terms. Conjecture terms whose lower bound is not
+//   below the best distance so far are skipped. Results for shared
+//   terms are cached (in a direct-mapped table of bounded size).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes data->cache, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static double ted_term_weight(Term_p term, TreeWeightParam_p data)
 {
-   long fd[i+1][j+1];
-   long di, dj;
-   
-   for (di=0; di<=i; di++) 
-   {
-      for (dj=0; dj<=j; dj++) 
-      {
-         fd[di][dj] = 0L;
-      }
-   }
+   long      i, sym, min = LONG_MAX;
+   TedTree_p query, conj;
+   double    *cached;
 
-   fd[l1[i]-1][l2[j]-1] = 0;
-   for (di=l1[i]; di<=i; di++) 
-   {
-      fd[di][l2[j]-1] = fd[di-1][l2[j]-1]+del_cost;
-   }
-   for (dj=l2[j]; dj<=j; dj++) 
+   if (PStackEmpty(data->terms))
    {
-      fd[l1[i]-1][dj] = fd[l1[i]-1][dj-1]+ins_cost;
+      return DBL_MAX;
    }
-   for (di=l1[i]; di<=i; di++)
+   if (TermIsShared(term))
    {
-      for (dj=l2[j]; dj<=j; dj++)
+      cached = TermWeightMemoFind(data->cache, term);
+      if (cached)
       {
-         if ((l1[di]==l1[i]) && (l2[dj]==l2[j]))
-         {
-            fd[di][dj] = MIN3(
-               fd[di-1][dj]+del_cost,
-               fd[di][dj-1]+ins_cost,
-               fd[di-1][dj-1]+(code1[di]==code2[dj]?0:ch_cost));
-            td[di][dj] = fd[di][dj];
-         }
-         else
-         {
-            fd[di][dj] = MIN3(
-               fd[di-1][dj]+del_cost,
-               fd[di][dj-1]+ins_cost,
-               fd[l1[di]-1][l2[dj]-1]+td[di][dj]);
-         }
+         return *cached;
       }
    }
-}
-
-static long ted_lmld_kr(
-   Term_p term, 
-   long* l,
-   PStack_p kr,
-   FunCode* code,
-   long* fresh, 
-   bool isroot)
-{
-   int i;
-   long idx, lidx;
-
-   if (TermIsVar(term)||TermIsConst(term)) 
-   {
-      idx = (*fresh)++;
-      l[idx] = idx;
-      lidx = idx;
-   }
-   else 
+   query = data->query = ted_tree_compute(data, term, data->query, false);
+   for (i=1; i<=query->len; i++)
    {
-      lidx = ted_lmld_kr(term->args[0],l,kr,code,fresh,false);
-      for (i=1; i<term->arity; i++)
+      sym = query->code[i];
+      if (sym != TED_NO_SYMBOL)
       {
-         ted_lmld_kr(term->args[i],l,kr,code,fresh,true);
+         data->hist[sym]++;
       }
-
-      idx = (*fresh)++;
-      l[idx] = l[lidx];
-   }
-
-   code[idx] = term->f_code;
-   if (isroot) 
-   {
-      PStackPushInt(kr, idx);
-      //printf(">>> key-root %ld\n", idx);
    }
-
-   //printf(">>> id=%ld; left-leaf=%ld     ",idx,l[idx]);
-   //TermPrint(GlobalOut,term,SIG,DEREF_NEVER);
-   //printf("\n");
-   return lidx;
-}
-
-static double ted_term_distance(
-   Term_p term1,
-   Term_p term2,
-   int ins_cost, 
-   int del_cost, 
-   int ch_cost)
-{
-   long len1 = TermWeight(term1,1,1);
-   long len2 = TermWeight(term2,1,1);
-   long l1[len1+1];
-   long l2[len2+1];
-   FunCode code1[len1+1];
-   FunCode code2[len2+1];
-   long td[len1+1][len2+1];
-   PStack_p kr1, kr2;
-   long fresh;
-   long x, y;
-
-   for (x=0; x<=len1; x++) 
+   for (i=0; i<data->terms->current; i++) 
    {
-      for (y=0; y<=len2; y++) 
+      conj = data->terms->stack[i].p_val;
+      if (ted_lower_bound(data, query, conj) < min)
       {
-         td[x][y] = 0L;
+         min = MIN(min, ted_term_distance(data, query, conj));
       }
    }
-   
-   kr1 = PStackAlloc();
-   kr2 = PStackAlloc();
-   
-   fresh=1; ted_lmld_kr(term1,l1,kr1,code1,&fresh,true);
-   fresh=1; ted_lmld_kr(term2,l2,kr2,code2,&fresh,true);
-
-   for (x=0; x<kr1->current; x++) 
+   for (i=1; i<=query->len; i++)
    {
-      for (y=0; y<kr2->current; y++)
+      sym = query->code[i];
+      if (sym != TED_NO_SYMBOL)
       {
-         ted_forest_distance( 
-            kr1->stack[x].i_val, kr2->stack[y].i_val,
-            l1, l2, code1, code2, len2+1, td,
-            ins_cost, del_cost, ch_cost);      
+         data->hist[sym] = 0;
       }
    }
-
-   PStackFree(kr1);
-   PStackFree(kr2);
-   
-   //printf("TED-DISTANCE    ");
-   //TermPrint(GlobalOut,term1,SIG,DEREF_NEVER);
-   //printf(" &&  ");
-   //TermPrint(GlobalOut,term2,SIG,DEREF_NEVER);
-   //printf(" = %ld\n",td[len1][len2]);
-
-   return td[len1][len2];
-}
-
-static double ted_term_weight(Term_p term, TreeWeightParam_p data)
-{
-   int i;
-   double min;
-   Term_p conj, norm;
-
-   norm = TermCopyNormalizeVars(data->vars,term,data->var_norm);
-
-   min = DBL_MAX;
-   for (i=0; i<data->terms->current; i++) 
+   if (TermIsShared(term))
    {
-      conj = data->terms->stack[i].p_val;
-      min = MIN(min,ted_term_distance(norm,conj,
-         data->ins_cost,data->del_cost,data->ch_cost));
+      *TermWeightMemoStore(data->cache, term) = min;
    }
-
-   TermFree(norm);
-
    return min;
 }
 
@@ -401,6 +710,16 @@ TreeWeightParam_p TreeWeightParamAlloc(void)
    
    res->terms = NULL;
    res->vars  = NULL;
+   res->symbols   = NULL;
+   res->sym_count = 0;
+   res->hist      = NULL;
+   res->query     = NULL;
+   res->norm_vars = NULL;
+   res->td        = NULL;
+   res->td_size   = 0;
+   res->fd        = NULL;
+   res->fd_size   = 0;
+   res->cache     = TermWeightMemoAlloc(TERM_WEIGHT_MEMO_BITS, 1);
    
    return res;
 }
@@ -419,14 +738,14 @@ TreeWeightParam_p TreeWeightParamAlloc(void)
 
 void TreeWeightParamFree(TreeWeightParam_p junk)
 {
-   Term_p term;
+   TedTree_p tree;
 
    if (junk->terms) 
    {
       while (!PStackEmpty(junk->terms)) 
       {
-         term = PStackPopP(junk->terms);
-         TermFree(term);
+         tree = PStackPopP(junk->terms);
+         ted_tree_free(tree);
       }
       PStackFree(junk->terms);
       junk->terms = NULL;
@@ -436,6 +755,22 @@ void TreeWeightParamFree(TreeWeightParam_p junk)
       VarBankFree(junk->vars);
       junk->vars = NULL;
    }
+   if (junk->symbols)
+   {
+      PDArrayFree(junk->symbols);
+      SizeFree(junk->hist, MAX(junk->sym_count,1)*sizeof(long));
+      PStackFree(junk->norm_vars);
+   }
+   if (junk->query)
+   {
+      ted_tree_free(junk->query);
+   }
+   if (junk->td)
+   {
+      SizeFree(junk->td, junk->td_size*sizeof(long));
+      SizeFree(junk->fd, junk->fd_size*sizeof(long));
+   }
+   TermWeightMemoFree(junk->cache);
    TreeWeightParamCellFree(junk);
 }
  
@@ -545,7 +880,8 @@ WFCB_p ConjectureTreeDistanceWeightInit(
       pos_multiplier,
       ext_style,
       (TermWeightFun)ted_term_weight,
-      data);
+      data,
+      false);
    
    return WFCBAlloc(
       ConjectureTreeDistanceWeightCompute, 
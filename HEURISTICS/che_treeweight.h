@@ -30,6 +30,21 @@
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
+/* A term in the form used by the Zhang-Shasha algorithm: Nodes are
+   numbered 1..len in postorder. */
+
+typedef struct ted_tree_cell
+{
+   long len;
+   long size;      /* Allocated entries of the arrays below */
+   long *lml;      /* Leftmost leaf of each node */
+   long *code;     /* Symbol index of each node */
+   long kr_no;
+   long *keyroots; /* In increasing order */
+   long hist_no;
+   long *hist;     /* (symbol index, count) pairs */
+}TedTreeCell, *TedTree_p;
+
 typedef struct treeweightparamcell
 {
    OCB_p        ocb;
@@ -39,11 +54,22 @@ typedef struct treeweightparamcell
    RelatedTermSet rel_terms;
 
    VarBank_p vars;
-   PStack_p terms;
+   PStack_p terms;       /* Conjecture terms as TedTree_p */
    int ins_cost;
    int del_cost; 
    int ch_cost;
 
+   PDArray_p symbols;    /* Encoded f_code -> symbol index+1 */
+   long      sym_count;  /* Symbols occuring in terms */
+   long      *hist;      /* Symbol counts of the current term */
+   TedTree_p query;      /* Scratch space for the current term... */
+   PStack_p  norm_vars;
+   long      *td;        /* ...and for the distance computation */
+   long      td_size;
+   long      *fd;
+   long      fd_size;
+   TermWeightMemo_p cache; /* Distances of shared terms */
+
    TermWeightExtension_p twe;
    void   (*init_fun)(struct treeweightparamcell*);
 }TreeWeightParamCell, *TreeWeightParam_p;
@@ -56,6 +82,8 @@ typedef struct treeweightparamcell
         SizeMalloc(sizeof(TreeWeightParamCell))
 #define TreeWeightParamCellFree(junk) \
         SizeFree(junk, sizeof(TreeWeightParamCell))
+#define TedTreeCellAlloc() (TedTreeCell*)SizeMalloc(sizeof(TedTreeCell))
+#define TedTreeCellFree(junk) SizeFree(junk, sizeof(TedTreeCell))
 
 TreeWeightParam_p TreeWeightParamAlloc(void);
 void              TreeWeightParamFree(TreeWeightParam_p junk);
@@ -63,6 +63,8 @@ WFCB_p WFCBAlloc(ClauseEvalFun wfcb_eval, ClausePrioFun prio_fun,
    handle->wfcb_priority = prio_fun;
    handle->wfcb_exit = wfcb_exit;
    handle->data = data;
+   handle->wfcb_classes = NULL;
+   handle->wfcb_class_eval = NULL;
 
    return handle;
 }
@@ -117,6 +119,37 @@ void ClauseAddEvaluation(WFCB_p wfcb, Clause_p clause, int pos, bool empty)
    }
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseAddClassEvaluation()
+//
+//   As ClauseAddEvaluation(), but compute the evaluation from the
+//   symbol class counts of the clause (see che_evalplan.h).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, by eval function
+//
+/----------------------------------------------------------------------*/
+
+void ClauseAddClassEvaluation(WFCB_p wfcb, Clause_p clause, int pos,
+                              bool empty, long* counts)
+{
+   assert(clause->evaluations);
+   assert(wfcb->wfcb_class_eval);
+   clause->evaluations->evals[pos].heuristic =
+      wfcb->wfcb_class_eval(wfcb->data, clause, counts);
+   if(empty)
+   {
+      clause->evaluations->evals[pos].priority = PrioBest;
+   }
+   else
+   {
+      clause->evaluations->evals[pos].priority  = wfcb->wfcb_priority(clause);
+   }
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
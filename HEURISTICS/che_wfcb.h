@@ -37,6 +37,19 @@
   This function is responsible for freeing data, before the WFCB is
   deleted.
 
+  Optionally, weight functions whose term weights are sums of
+  per-symbol weights that only depend on a small class of the symbol
+  can provide
+
+  SymClassMap_p <Eval>Classes(void* data)
+  double <eval>ClassCompute(void* data, Clause_p clause, long* counts)
+
+  The first returns the classification (or NULL if the weight cannot
+  be expressed this way), the second computes the same evaluation as
+  <eval>Compute from the number of symbols of each class in each
+  term. This allows the evaluation planner (che_evalplan.h) to count
+  symbol classes for several WFCBs in one pass over the clause.
+
   Copyright 1998-2018 by the authors (see DOC/CONTRIBUTORS).
   This code is released under the GNU General Public Licence and
   the GNU Lesser General Public License.
@@ -68,6 +81,31 @@
 typedef double (*ClauseEvalFun)(void* data, Clause_p
                                 clause);
 
+/* Classification of function symbols. Variables are always in class
+   SYM_CLASS_VAR, symbols with f_code >= flimit in SYM_CLASS_OTHER,
+   all others in fclass[f_code] (which must be smaller than
+   SYM_CLASS_NO). Terms are counted after the maximal terms of the
+   clause have been marked with ocb, so that lterm and rterm are
+   final. */
+
+#define SYM_CLASS_VAR   0
+#define SYM_CLASS_OTHER 1
+#define SYM_CLASS_NO    8
+
+typedef struct sym_class_map_cell
+{
+   OCB_p         ocb;
+   long          flimit;
+   unsigned char *fclass;
+}SymClassMapCell, *SymClassMap_p;
+
+typedef SymClassMap_p (*ClauseClassesFun)(void* data);
+
+/* counts holds 2*SYM_CLASS_NO entries per literal, first the class
+   counts of the lterm, then those of the rterm. */
+typedef double (*ClauseClassEvalFun)(void* data, Clause_p clause,
+                                     long* counts);
+
 typedef struct wfcb_cell
 {
    ClauseEvalFun     wfcb_eval;     /* Compute a clauses evaluation */
@@ -77,6 +115,8 @@ typedef struct wfcb_cell
    void*             data;          /* WFCB-Data...each set of
                                        evaluation functions is
                                        responsible for cleaning up...*/
+   ClauseClassesFun  wfcb_classes;  /* Optional, see above */
+   ClauseClassEvalFun wfcb_class_eval;
 }WFCBCell, *WFCB_p;
 
 typedef WFCB_p (*WeightFunParseFun)(Scanner_p in, OCB_p ocb,
@@ -95,6 +135,8 @@ WFCB_p WFCBAlloc(ClauseEvalFun wfcb_eval, ClausePrioFun prio_fun,
 void   WFCBFree(WFCB_p junk);
 
 void   ClauseAddEvaluation(WFCB_p wfcb, Clause_p clause, int pos, bool empty);
+void   ClauseAddClassEvaluation(WFCB_p wfcb, Clause_p clause, int pos,
+                                bool empty, long* counts);
 
 #endif
 
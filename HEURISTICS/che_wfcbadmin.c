@@ -70,6 +70,7 @@ char* WeightFunParseFunNames[]=
    "ConjectureTreeDistanceWeight",
    "ConjectureTermPrefixWeight",
    "ConjectureStrucDistanceWeight",
+   "LinearModelWeight",
    NULL
 };
 
@@ -114,6 +115,7 @@ static WeightFunParseFun parse_fun_array[]=
    ConjectureTreeDistanceWeightParse,
    ConjectureTermPrefixWeightParse,
    ConjectureStrucDistanceWeightParse,
+   LinearModelWeightParse,
    (WeightFunParseFun)NULL
 };
 
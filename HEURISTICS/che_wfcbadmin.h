@@ -39,6 +39,7 @@ Changes
 #include <che_treeweight.h>
 #include <che_prefixweight.h>
 #include <che_strucweight.h>
+#include <che_linmodelweight.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -19,6 +19,8 @@ Changes
 
 <1> Fri Nov  6 14:50:28 MET 1998
     New
+<2> Mon Oct 19 04:25:45 CEST 2026
+    SIGUSR1 requests memory statistics
 
 -----------------------------------------------------------------------*/
 
@@ -36,6 +38,7 @@ rlim_t                SoftTimeLimit     = RLIM_INFINITY;
 rlim_t                HardTimeLimit     = RLIM_INFINITY;
 sig_atomic_t TimeIsUp          = 0;
 sig_atomic_t TimeLimitIsSoft   = 0;
+sig_atomic_t MemStatsRequested = 0;
 static sig_atomic_t fatal_error_in_progress = 0;
 bool                  SilentTimeOut     = false;
 
@@ -149,6 +152,10 @@ void ESignalHandler(int mysignal)
     TempFileCleanup();
     raise(mysignal);
     break;
+   case SIGUSR1:
+         /* Printing is not async-signal-safe, the main loop does it */
+         MemStatsRequested = 1;
+    break;
    default:
       WriteStr(STDERR_FILENO, "Warning: ");
       WriteStr(STDERR_FILENO, "Unexpected signal caught, continuing");
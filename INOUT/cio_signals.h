@@ -59,6 +59,17 @@ extern rlim_t                HardTimeLimit;   /* Exit now! */
 extern sig_atomic_t TimeIsUp;
 extern sig_atomic_t TimeLimitIsSoft; /* Have we hit hard or
                    soft? */
+extern sig_atomic_t MemStatsRequested; /* SIGUSR1 received, print
+                                          MemClassStatsPrint() */
+
+/* Service a pending SIGUSR1 request. This is polled while parsing,
+   during clausification, and in the main saturation loop. A request
+   that arrives during other phases (e.g. clause set preprocessing or
+   SInE) is answered at the next of these points. */
+#define MemStatsPoll()                                                  \
+   do{ if(UNLIKELY(MemStatsRequested))                                  \
+       {MemStatsRequested = 0; MemClassStatsPrint(stderr); fflush(stderr);} \
+   }while(0)
 extern bool                  SilentTimeOut;
 
 void ESignalSetup(int mysignal);
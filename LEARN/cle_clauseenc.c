@@ -83,7 +83,7 @@ Term_p FlatEncodeClauseListRep(TB_p bank, PStack_p list)
       }
    }
    handle = TBTermTopInsert(bank, handle);
-   assert(handle->weight ==
+   assert(TermCellWeight(handle) ==
      TermWeight(handle,DEFAULT_VWEIGHT,DEFAULT_FWEIGHT));
 
    return handle;
@@ -134,7 +134,7 @@ Term_p   RecEncodeClauseListRep(TB_p bank, PStack_p list)
       rest = TBTermTopInsert(bank, handle);
 
    }
-   assert(rest->weight ==
+   assert(TermCellWeight(rest) ==
      TermWeight(rest,DEFAULT_VWEIGHT,DEFAULT_FWEIGHT));
    return rest;
 }
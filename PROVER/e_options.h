@@ -40,6 +40,11 @@ typedef enum
    OPT_OUTPUT,
    OPT_PRINT_STATISTICS,
    OPT_EXPENSIVE_DETAILS,
+   OPT_PRINT_MEM_CLASSES,
+   OPT_PERF_COUNTERS,
+   OPT_PROGRESS_STREAM,
+   OPT_PROGRESS_INTERVAL,
+   OPT_RECORD_GIVEN,
    OPT_PRINT_SATURATED,
    OPT_PRINT_SAT_INFO,
    OPT_FILTER_SATURATED,
@@ -60,6 +65,8 @@ typedef enum
    OPT_PCL_COMPACT,
    OPT_PCL_SHELL_LEVEL,
    OPT_MEM_LIMIT,
+   OPT_FREE_LIST_LIMIT,
+   OPT_HUGE_PAGES,
    OPT_CPU_LIMIT,
    OPT_SOFTCPU_LIMIT,
    OPT_RUSAGE_INFO,
@@ -87,6 +94,7 @@ typedef enum
    OPT_SATAUTODEV,
    OPT_AUTO_SCHED,
    OPT_SATAUTO_SCHED,
+   OPT_AUTO_TABLE_FILE,
    OPT_NO_PREPROCESSING,
    OPT_EQ_UNFOLD_LIMIT,
    OPT_EQ_UNFOLD_MAXCLAUSES,
@@ -315,6 +323,51 @@ OptCell opts[] =
     "to collect. Includes number of term cells and number of "
     "rewrite steps."},
 
+   {OPT_PRINT_MEM_CLASSES,
+    '\0', "print-memory-classes",
+    NoArg, NULL,
+    "Print the live objects, live bytes and peak bytes per allocation "
+    "class (terms, clauses, literals, evaluations, index nodes, "
+    "stacks) and the memory retained in free lists at the end of the "
+    "run. The same report is printed to stderr whenever the prover "
+    "receives SIGUSR1."},
+
+   {OPT_PERF_COUNTERS,
+    '\0', "perf-counters",
+    OptArg, "-",
+    "Enable the internal performance counters (timers, call counts and "
+    "duration histograms for major inference and indexing operations). "
+    "Their totals are added to the statistics, and at the end of the run "
+    "all data is written as a JSON object to the file given as the "
+    "argument (or to stdout if the argument is '-' or omitted)."},
+
+   {OPT_PROGRESS_STREAM,
+    '\0', "progress-stream",
+    ReqArg, NULL,
+    "Periodically emit a one-line JSON record describing the state of "
+    "the proof search (processed, unprocessed and generated clauses, "
+    "clauses per second, term bank and index sizes, estimated storage "
+    "and memory high water mark). The argument is either the number "
+    "of an open file descriptor, the path of a listening UNIX domain "
+    "stream socket, or the name of a file to append to. A single "
+    "final record is emitted when the proof search terminates. If the "
+    "reader closes the stream, records are silently dropped."},
+
+   {OPT_PROGRESS_INTERVAL,
+    '\0', "progress-interval",
+    ReqArg, NULL,
+    "Set the minimal time in milliseconds between two records emitted "
+    "via --progress-stream. The default is 1000."},
+
+   {OPT_RECORD_GIVEN,
+    '\0', "record-given-clauses",
+    ReqArg, NULL,
+    "Write every given clause that survives forward simplification to "
+    "the named file (in TPTP-3 format, '-' is stdout). The result is a "
+    "workload that can be replayed with the kernel_bench program in "
+    "SIMPLE_APPS. Use this with a single strategy, not with an "
+    "automatic schedule."},
+
    {OPT_PRINT_SATURATED,
     'S', "print-saturated",
     OptArg, DEFAULT_OUTPUT_DESCRIPTOR,
@@ -407,6 +460,23 @@ OptCell opts[] =
     "data types, it is currently impossible to set a limit of more than "
     "2 GB (2048 MB)."},
 
+   {OPT_FREE_LIST_LIMIT,
+    '\0', "free-list-limit",
+    ReqArg, NULL,
+    "Limit the memory (in MB) that is kept in internal free lists for "
+    "reuse. Memory freed beyond this limit is handed back to the C "
+    "library and periodically returned to the operating system, so "
+    "that the process shrinks again after peaks. The default is 256."},
+
+   {OPT_HUGE_PAGES,
+    '\0', "huge-pages",
+    NoArg, NULL,
+    "Allocate terms, clauses, literals and index nodes from a memory "
+    "region that is backed by transparent huge pages (where the "
+    "operating system supports this). This reduces address translation "
+    "overhead on large proof searches. Memory in this region is reused, "
+    "but never returned to the operating system."},
+
    {OPT_CPU_LIMIT,
     '\0', "cpu-limit",
     OptArg, "300",
@@ -627,6 +697,16 @@ OptCell opts[] =
     "Use the (experimental) strategy scheduling without SInE, thus "
     "maintaining completeness."},
 
+   {OPT_AUTO_TABLE_FILE,
+    '\0', "auto-table-file",
+    ReqArg, NULL,
+    "Read the tables associating problem classes with search "
+    "strategies for the automatic modes from the given file. A table "
+    "in the file, given as table(<mode>) followed by its cases, "
+    "replaces the built-in table of the mode of that name (e.g. Auto, "
+    "AutoDev, AutoSched0). See HEURISTICS/che_autotables.h for the "
+    "format."},
+
    {OPT_NO_PREPROCESSING,
     '\0', "no-preprocessing",
     NoArg, NULL,
@@ -50,11 +50,16 @@ PERF_CTR_DEFINE(SatTimer);
 
 char              *outname = NULL;
 char              *watchlist_filename = NULL;
+char              *perf_ctr_filename = NULL;
+char              *progress_dest = NULL;
+long              progress_interval = PROGRESS_DEFAULT_INTERVAL;
+char              *given_record_filename = NULL;
 HeuristicParms_p  h_parms;
 FVIndexParms_p    fvi_parms;
 bool              print_sat = false,
    print_full_deriv = false,
    print_statistics = false,
+   print_mem_classes = false,
    filter_sat = false,
    print_rusage = false,
    print_pid = false,
@@ -223,8 +228,10 @@ static void print_info(void)
 //
 // Global Variables: OutputLevel,
 //                   print_statistics
+//                   print_mem_classes
 //                   GlobalOut,
 //                   ClauseClauseSubsumptionCalls,
+//                   ClauseClauseSubsumptionSigFails,
 //                   ClauseClauseSubsumptionCallsRec,
 //                   ClauseClauseSubsumptionSuccesses,
 //                   UnitClauseClauseSubsumptionCalls,
@@ -248,6 +255,11 @@ static void print_info(void)
 //                   (possibly) FVIndexTimer);
 //                   (possibly) SubsumeTimer);
 //                   (possibly) SetSubsumeTimer
+//                   (possibly) ClauseEvalTimer
+//                   (possibly) LitSelTimer
+//                   (possibly) FWContrTimer
+//                   (possibly) SatCheckTimer
+//                   (possibly) GCTimer
 //
 // Side Effects    : Output of collected statistics.
 //
@@ -273,6 +285,8 @@ static void print_proof_stats(ProofState_p proofstate,
       ProofStateStatisticsPrint(GlobalOut, proofstate);
       fprintf(GlobalOut, "# Clause-clause subsumption calls (NU) : %ld\n",
               ClauseClauseSubsumptionCalls);
+      fprintf(GlobalOut, "# Rejected by literal signatures       : %ld\n",
+              ClauseClauseSubsumptionSigFails);
       fprintf(GlobalOut, "# Rec. Clause-clause subsumption calls : %ld\n",
               ClauseClauseSubsumptionCallsRec);
       fprintf(GlobalOut, "# Non-unit clause-clause subsumptions  : %ld\n",
@@ -305,6 +319,7 @@ static void print_proof_stats(ProofState_p proofstate,
       PERF_CTR_PRINT(GlobalOut, MguTimer);
       PERF_CTR_PRINT(GlobalOut, SatTimer);
       PERF_CTR_PRINT(GlobalOut, ParamodTimer);
+      PERF_CTR_PRINT(GlobalOut, FWContrTimer);
       PERF_CTR_PRINT(GlobalOut, PMIndexTimer);
       PERF_CTR_PRINT(GlobalOut, IndexUnifTimer);
       PERF_CTR_PRINT(GlobalOut, BWRWTimer);
@@ -315,6 +330,9 @@ static void print_proof_stats(ProofState_p proofstate,
       PERF_CTR_PRINT(GlobalOut, SubsumeTimer);
       PERF_CTR_PRINT(GlobalOut, SetSubsumeTimer);
       PERF_CTR_PRINT(GlobalOut, ClauseEvalTimer);
+      PERF_CTR_PRINT(GlobalOut, LitSelTimer);
+      PERF_CTR_PRINT(GlobalOut, SatCheckTimer);
+      PERF_CTR_PRINT(GlobalOut, GCTimer);
 
 #ifdef PRINT_INDEX_STATS
       fprintf(GlobalOut, "# Backwards rewriting index : ");
@@ -340,6 +358,10 @@ static void print_proof_stats(ProofState_p proofstate,
 #endif
       // PDTreePrint(GlobalOut, proofstate->processed_pos_rules->demod_index);
    }
+   if(print_mem_classes)
+   {
+      MemClassStatsPrint(GlobalOut);
+   }
 }
 
 
@@ -387,6 +409,7 @@ int main(int argc, char* argv[])
    InitIO(NAME);
 
    ESignalSetup(SIGXCPU);
+   ESignalSetup(SIGUSR1);
 
    h_parms = HeuristicParmsAlloc();
    fvi_parms = FVIndexParmsAlloc();
@@ -505,6 +528,14 @@ int main(int argc, char* argv[])
    //printf("Alive (1)!\n");
 
    ProofStateInit(proofstate, proofcontrol);
+   if(progress_dest)
+   {
+      SaturateProgress = ProgressAlloc(progress_dest, progress_interval);
+   }
+   if(given_record_filename)
+   {
+      GivenClauseRecord = OutOpen(given_record_filename);
+   }
    //printf("Alive (2)!\n");
    //ProofStateInitWatchlist(proofstate, proofcontrol->ocb);
 
@@ -544,6 +575,10 @@ int main(int argc, char* argv[])
                          generated_limit, tb_insert_limit, answer_limit);
    }
    PERF_CTR_EXIT(SatTimer);
+   if(SaturateProgress)
+   {
+      ProgressReport(SaturateProgress, proofstate, "final");
+   }
 
    if(SigHasUnimplementedInterpretedSymbols(proofstate->signature))
    {
@@ -751,6 +786,23 @@ int main(int argc, char* argv[])
                      relevancy_pruned,
                      raw_clause_no,
                      preproc_removed);
+   if(perf_ctr_filename)
+   {
+      FILE* perf_out = OutOpen(perf_ctr_filename);
+
+      PerfCtrsPrintJSON(perf_out);
+      OutClose(perf_out);
+   }
+   if(SaturateProgress)
+   {
+      ProgressFree(SaturateProgress);
+      SaturateProgress = NULL;
+   }
+   if(GivenClauseRecord)
+   {
+      OutClose(GivenClauseRecord);
+      GivenClauseRecord = NULL;
+   }
 #ifndef FAST_EXIT
 #ifdef FULL_MEM_STATS
    fprintf(GlobalOut,
@@ -784,6 +836,7 @@ cleanup1:
    PStackFree(wfcb_definitions);
    FVIndexParmsFree(fvi_parms);
    HeuristicParmsFree(h_parms);
+   AutoTablesFree();
 #ifdef FULL_MEM_STATS
    MemFreeListPrint(GlobalOut);
 #endif
@@ -924,6 +977,22 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_EXPENSIVE_DETAILS:
             TBPrintDetails = true;
             break;
+      case OPT_PRINT_MEM_CLASSES:
+            print_mem_classes = true;
+            break;
+      case OPT_PERF_COUNTERS:
+            PerfCtrsEnabled = true;
+            perf_ctr_filename = arg;
+            break;
+      case OPT_PROGRESS_STREAM:
+            progress_dest = arg;
+            break;
+      case OPT_PROGRESS_INTERVAL:
+            progress_interval = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_RECORD_GIVEN:
+            given_record_filename = arg;
+            break;
       case OPT_PRINT_SATURATED:
             outdesc = arg;
             CheckOptionLetterString(outdesc, "teigEIGaA", "-S (--print-saturated)");
@@ -985,6 +1054,15 @@ CLState_p process_options(int argc, char* argv[])
                             (long long)mem_limit););
             h_parms->mem_limit = MEGA*mem_limit;
             break;
+      case OPT_FREE_LIST_LIMIT:
+            MemFreeListLimit = CLStateGetIntArg(handle, arg)*MEGA;
+            break;
+      case OPT_HUGE_PAGES:
+            if(!MemHugeEnable())
+            {
+               Warning("Huge page backed memory is not available");
+            }
+            break;
       case OPT_CPU_LIMIT:
             HardTimeLimit = CLStateGetIntArg(handle, arg);
             ScheduleTimeLimit = HardTimeLimit;
@@ -1095,6 +1173,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_SATAUTO_SCHED:
             strategy_scheduling = true;
             break;
+      case OPT_AUTO_TABLE_FILE:
+            AutoTableFile = arg;
+            break;
       case OPT_NO_PREPROCESSING:
             no_preproc = true;
             break;
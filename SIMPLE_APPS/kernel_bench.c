@@ -0,0 +1,1026 @@
+/*-----------------------------------------------------------------------
+
+File  : kernel_bench.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Microbenchmarks for the core data structures and algorithms of
+  E. Read a clause stream (typically the given clauses of a real
+  proof run, recorded with eprover --record-given-clauses) and replay
+  it through term bank insertion, matching, unification, the
+  perfect discrimination tree, fingerprint and feature vector
+  indices, KBO comparisons, and clause subsumption. Term and clause
+  pairs are taken from a sliding window over the stream, so that
+  the workload retains the locality of the original proof search.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 03:07:25 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <clb_perfctr.h>
+#include <ccl_formulafunc.h>
+#include <ccl_subsumption.h>
+#include <cto_kbolin.h>
+#include <che_to_precgen.h>
+#include <che_to_weightgen.h>
+#include <e_version.h>
+
+
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+#define NAME "kernel_bench"
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERSION,
+   OPT_VERBOSE,
+   OPT_OUTPUT,
+   OPT_REPEAT,
+   OPT_WINDOW,
+   OPT_KERNELS,
+   OPT_FP_INDEX,
+   OPT_LOP_PARSE,
+   OPT_TPTP_PARSE,
+   OPT_TSTP_PARSE
+}OptionCodes;
+
+
+/* The recorded workload. terms are the literal sides of all clauses
+   in stream order, dterms the corresponding sides of
+   variable-disjoint copies, subterms all non-variable subterm
+   occurrences (the queries of rewriting). */
+
+typedef struct workloadcell
+{
+   TB_p        bank;
+   OCB_p       ocb;
+   ClauseSet_p clauses;
+   ClauseSet_p copies;
+   PStack_p    clause_stack;
+   PStack_p    terms;
+   PStack_p    dterms;
+   PStack_p    subterms;
+}WorkloadCell, *Workload_p;
+
+/* Result of a single run of a kernel. Only the time spent in the
+   measured operations is accounted in ns, not the setup. storage is
+   the size of the data structure the kernel works on (in bytes, if
+   known), to relate the timing to the cache hierarchy. */
+
+typedef struct kernelrescell
+{
+   long      ops;
+   long      results;
+   long long ns;
+   long      storage;
+}KernelResCell, *KernelRes_p;
+
+typedef void (*KernelFun)(Workload_p wl, KernelRes_p res);
+
+typedef struct kernelcell
+{
+   char      *name;
+   KernelFun fun;
+   char      *desc;
+}KernelCell, *Kernel_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+
+   {OPT_VERSION,
+    '\0', "version",
+    NoArg, NULL,
+    "Print the version number of the program."},
+
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program by printing "
+    "technical information to stderr."},
+
+   {OPT_OUTPUT,
+    'o', "output-file",
+    ReqArg, NULL,
+   "Redirect output into the named file."},
+
+   {OPT_REPEAT,
+    'r', "repeat",
+    ReqArg, NULL,
+    "Run each kernel the given number of times and report the best and "
+    "the median time. The default is 5."},
+
+   {OPT_WINDOW,
+    'w', "window",
+    ReqArg, NULL,
+    "Size of the sliding window used to form term and clause pairs. "
+    "Each term (clause) is paired with the next n terms (clauses) of "
+    "the stream. The default is 8."},
+
+   {OPT_KERNELS,
+    'k', "kernels",
+    ReqArg, NULL,
+    "Comma-separated list of the kernels to run. The default is to run "
+    "all kernels. Run with --help to see the list of kernels."},
+
+   {OPT_FP_INDEX,
+    '\0', "fp-index",
+    ReqArg, NULL,
+    "Select the fingerprint function used by the fpindex kernel. The "
+    "default is FP7."},
+
+   {OPT_LOP_PARSE,
+    '\0', "lop-in",
+    NoArg, NULL,
+    "Set E-LOP as the input format. If no input format is "
+    "selected by this or one of the following options, E will "
+    "guess the input format based on the first token."},
+
+   {OPT_TPTP_PARSE,
+    '\0', "tptp-in",
+    NoArg, NULL,
+    "Parse TPTP-2 format instead of E-LOP."},
+
+   {OPT_TSTP_PARSE,
+    '\0', "tstp-in",
+    NoArg, NULL,
+    "Parse TPTP-3 format instead of E-LOP."},
+
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+char        *outname      = NULL;
+IOFormat    parse_format  = AutoFormat;
+long        repeat        = 5;
+long        window        = 8;
+char        *kernel_names = NULL;
+char        *fp_index     = "FP7";
+bool        app_encode    = false;
+ProblemType problemType   = PROBLEM_NOT_INIT;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_tbinsert()
+//
+//   Insert all terms into a fresh term bank.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_tbinsert(Workload_p wl, KernelRes_p res)
+{
+   TB_p      bank = TBAlloc(wl->bank->sig);
+   long      i;
+   long long start;
+
+   start = PerfCtrNow();
+   for(i=0; i<PStackGetSP(wl->terms); i++)
+   {
+      TBInsert(bank, PStackElementP(wl->terms, i), DEREF_NEVER);
+   }
+   res->ns      = PerfCtrNow()-start;
+   res->ops     = PStackGetSP(wl->terms);
+   res->results = TBNonVarTermNodes(bank);
+   res->storage = TBNonVarTermNodes(bank)*sizeof(TermCell);
+
+   bank->sig = NULL;
+   TBFree(bank);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_match()
+//
+//   Try to match each term onto the terms in the following window.
+//
+// Global Variables: window
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_match(Workload_p wl, KernelRes_p res)
+{
+   Subst_p   subst = SubstAlloc();
+   long      i, j, n = PStackGetSP(wl->terms);
+   long long start;
+
+   start = PerfCtrNow();
+   for(i=0; i<n; i++)
+   {
+      for(j=1; j<=window; j++)
+      {
+         if(SubstComputeMatch(PStackElementP(wl->terms, i),
+                              PStackElementP(wl->terms, (i+j)%n), subst))
+         {
+            res->results++;
+         }
+         SubstBacktrack(subst);
+      }
+   }
+   res->ns  = PerfCtrNow()-start;
+   res->ops = n*window;
+   SubstFree(subst);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_mgu()
+//
+//   Try to unify each term with variable-disjoint copies of the terms
+//   in the following window.
+//
+// Global Variables: window
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_mgu(Workload_p wl, KernelRes_p res)
+{
+   Subst_p   subst = SubstAlloc();
+   long      i, j, n = PStackGetSP(wl->terms);
+   long long start;
+
+   start = PerfCtrNow();
+   for(i=0; i<n; i++)
+   {
+      for(j=1; j<=window; j++)
+      {
+         if(SubstComputeMgu(PStackElementP(wl->terms, i),
+                            PStackElementP(wl->dterms, (i+j)%n), subst))
+         {
+            res->results++;
+         }
+         SubstBacktrack(subst);
+      }
+   }
+   res->ns  = PerfCtrNow()-start;
+   res->ops = n*window;
+   SubstFree(subst);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_pdtree()
+//
+//   Index all positive unit clauses in a perfect discrimination tree
+//   and retrieve all generalizations (i.e. all candidate
+//   demodulators) for every subterm.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_pdtree(Workload_p wl, KernelRes_p res)
+{
+   ClauseSet_p demods = ClauseSetAlloc();
+   Subst_p     subst = SubstAlloc();
+   Clause_p    clause, copy;
+   MatchRes_p  mi;
+   Term_p      term;
+   SysDate     date = SysDateCreationTime();
+   long        i;
+   long long   start;
+
+   SysDateInc(&date);
+   demods->demod_index = PDTreeAlloc(wl->bank);
+   for(clause = wl->clauses->anchor->succ;
+       clause != wl->clauses->anchor;
+       clause = clause->succ)
+   {
+      if(ClauseIsUnit(clause) && clause->pos_lit_no)
+      {
+         copy = ClauseCopy(clause, wl->bank);
+         copy->date = date;
+         ClauseSetPDTIndexedInsert(demods, copy);
+      }
+   }
+   start = PerfCtrNow();
+   for(i=0; i<PStackGetSP(wl->subterms); i++)
+   {
+      term = PStackElementP(wl->subterms, i);
+      PDTreeSearchInit(demods->demod_index, term,
+                       SysDateCreationTime(), false);
+      while((mi = PDTreeFindNextDemodulator(demods->demod_index, subst)))
+      {
+         res->results++;
+         MatchResFree(mi);
+      }
+      PDTreeSearchExit(demods->demod_index);
+   }
+   res->ns      = PerfCtrNow()-start;
+   res->ops     = PStackGetSP(wl->subterms);
+   res->storage = PDTreeStorage(demods->demod_index);
+
+   SubstFree(subst);
+   ClauseSetFree(demods);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_fpindex()
+//
+//   Index all subterms in a fingerprint index and retrieve the
+//   candidates for unification for all literal sides.
+//
+// Global Variables: fp_index
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_fpindex(Workload_p wl, KernelRes_p res)
+{
+   FPIndex_p index;
+   PStack_p  collect = PStackAlloc();
+   long      i;
+   long long start;
+
+   index = FPIndexAlloc(GetFPIndexFunction(fp_index), wl->bank->sig, NULL);
+   for(i=0; i<PStackGetSP(wl->subterms); i++)
+   {
+      FPIndexInsert(index, PStackElementP(wl->subterms, i));
+   }
+   start = PerfCtrNow();
+   for(i=0; i<PStackGetSP(wl->dterms); i++)
+   {
+      res->results += FPIndexFindUnifiable(index,
+                                           PStackElementP(wl->dterms, i),
+                                           collect);
+      PStackReset(collect);
+   }
+   res->ns  = PerfCtrNow()-start;
+   res->ops = PStackGetSP(wl->dterms);
+
+   FPIndexFree(index);
+   PStackFree(collect);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_fvsubsume()
+//
+//   Replay the clause stream as forward subsumption against a feature
+//   vector index: Each clause is checked against the clauses before
+//   it and inserted if it is not subsumed. Only the subsumption
+//   checks are timed.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_fvsubsume(Workload_p wl, KernelRes_p res)
+{
+   ClauseSet_p      set = ClauseSetAlloc();
+   FVCollect_p      cspec;
+   FVPackedClause_p pclause;
+   Clause_p         copy, subsumer;
+   long             i;
+   long long        start;
+
+   cspec = BillPlusFeaturesCollectAlloc(wl->bank->sig,
+                                        wl->bank->sig->f_count*2+4);
+   set->fvindex = FVIAnchorAlloc(cspec,
+                                 PermVectorCompute(wl->clauses, cspec, true));
+   for(i=0; i<PStackGetSP(wl->clause_stack); i++)
+   {
+      copy = ClauseCopy(PStackElementP(wl->clause_stack, i), wl->bank);
+      ClauseUpdateSubsumeInfo(copy);
+      pclause = FVIndexPackClause(copy, set->fvindex);
+
+      start = PerfCtrNow();
+      subsumer = ClauseSetSubsumesFVPackedClause(set, pclause);
+      res->ns += PerfCtrNow()-start;
+
+      if(subsumer)
+      {
+         res->results++;
+         ClauseFree(FVUnpackClause(pclause));
+      }
+      else
+      {
+         ClauseSetIndexedInsert(set, pclause);
+         FVUnpackClause(pclause);
+      }
+   }
+   res->ops     = PStackGetSP(wl->clause_stack);
+   res->storage = FVIndexStorage(set->fvindex);
+
+   ClauseSetFree(set);
+   FVCollectFree(cspec);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_kbo()
+//
+//   Compare each term with the terms in the following window.
+//
+// Global Variables: window
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void bench_kbo(Workload_p wl, KernelRes_p res)
+{
+   long      i, j, n = PStackGetSP(wl->terms);
+   long long start;
+
+   start = PerfCtrNow();
+   for(i=0; i<n; i++)
+   {
+      for(j=1; j<=window; j++)
+      {
+         if(KBO6Compare(wl->ocb, PStackElementP(wl->terms, i),
+                        PStackElementP(wl->terms, (i+j)%n),
+                        DEREF_NEVER, DEREF_NEVER) != to_uncomparable)
+         {
+            res->results++;
+         }
+      }
+   }
+   res->ns  = PerfCtrNow()-start;
+   res->ops = n*window;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_subsume()
+//
+//   Check if each clause subsumes the clauses in the following
+//   window.
+//
+// Global Variables: window
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void bench_subsume(Workload_p wl, KernelRes_p res)
+{
+   long      i, j, n = PStackGetSP(wl->clause_stack);
+   long long start;
+
+   start = PerfCtrNow();
+   for(i=0; i<n; i++)
+   {
+      for(j=1; j<=window; j++)
+      {
+         if(ClauseSubsumesClause(PStackElementP(wl->clause_stack, i),
+                                 PStackElementP(wl->clause_stack, (i+j)%n)))
+         {
+            res->results++;
+         }
+      }
+   }
+   res->ns  = PerfCtrNow()-start;
+   res->ops = n*window;
+}
+
+
+KernelCell kernels[] =
+{
+   {"tbinsert",  bench_tbinsert,  "TBInsert() into a fresh term bank"},
+   {"match",     bench_match,     "SubstComputeMatch() on term pairs"},
+   {"mgu",       bench_mgu,       "SubstComputeMgu() on term pairs"},
+   {"pdtree",    bench_pdtree,    "PDTree retrieval of demodulators"},
+   {"fpindex",   bench_fpindex,   "FPIndexFindUnifiable()"},
+   {"fvsubsume", bench_fvsubsume, "forward subsumption via FV index"},
+   {"kbo",       bench_kbo,       "KBO6Compare() on term pairs"},
+   {"subsume",   bench_subsume,   "ClauseSubsumesClause() on clause pairs"},
+   {NULL,        NULL,            NULL}
+};
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: collect_subterms()
+//
+//   Push all non-variable subterm occurrences of term onto stack.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void collect_subterms(PStack_p stack, Term_p term)
+{
+   PStack_p todo = PStackAlloc();
+   int      i;
+
+   PStackPushP(todo, term);
+   while(!PStackEmpty(todo))
+   {
+      term = PStackPopP(todo);
+      if(!TermIsVar(term))
+      {
+         PStackPushP(stack, term);
+         for(i=term->arity-1; i>=0; i--)
+         {
+            PStackPushP(todo, term->args[i]);
+         }
+      }
+   }
+   PStackFree(todo);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: workload_init()
+//
+//   Build the derived data of the workload (ordering, term stacks,
+//   disjoint copies) from wl->clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void workload_init(Workload_p wl)
+{
+   Clause_p clause, copy;
+   Eqn_p    lit;
+
+   wl->ocb = OCBAlloc(KBO6, false, wl->bank->sig);
+   TOGeneratePrecedence(wl->ocb, wl->clauses, NULL, PUnaryFirst);
+   TOGenerateWeights(wl->ocb, wl->clauses, NULL, WSelectMaximal,
+                     W_DEFAULT_WEIGHT);
+   ClauseSetMarkMaximalTerms(wl->ocb, wl->clauses);
+
+   wl->copies       = ClauseSetAlloc();
+   wl->clause_stack = PStackAlloc();
+   wl->terms        = PStackAlloc();
+   wl->dterms       = PStackAlloc();
+   wl->subterms     = PStackAlloc();
+
+   for(clause = wl->clauses->anchor->succ;
+       clause != wl->clauses->anchor;
+       clause = clause->succ)
+   {
+      ClauseSubsumeOrderSortLits(clause);
+      ClauseUpdateSubsumeInfo(clause);
+      PStackPushP(wl->clause_stack, clause);
+      for(lit = clause->literals; lit; lit = lit->next)
+      {
+         PStackPushP(wl->terms, lit->lterm);
+         PStackPushP(wl->terms, lit->rterm);
+         collect_subterms(wl->subterms, lit->lterm);
+         collect_subterms(wl->subterms, lit->rterm);
+      }
+      copy = ClauseCopyDisjoint(clause);
+      for(lit = copy->literals; lit; lit = lit->next)
+      {
+         PStackPushP(wl->dterms, lit->lterm);
+         PStackPushP(wl->dterms, lit->rterm);
+      }
+      ClauseSetInsert(wl->copies, copy);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: workload_exit()
+//
+//   Free the derived data of the workload.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void workload_exit(Workload_p wl)
+{
+   PStackFree(wl->clause_stack);
+   PStackFree(wl->terms);
+   PStackFree(wl->dterms);
+   PStackFree(wl->subterms);
+   ClauseSetFree(wl->copies);
+   OCBFree(wl->ocb);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: kernel_selected()
+//
+//   Return true if the kernel name is in the comma-separated list
+//   kernel_names (or no list was given).
+//
+// Global Variables: kernel_names
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool kernel_selected(char* name)
+{
+   char *pos;
+   size_t len = strlen(name);
+
+   if(!kernel_names)
+   {
+      return true;
+   }
+   for(pos = kernel_names; pos; pos = strchr(pos, ','))
+   {
+      if(*pos == ',')
+      {
+         pos++;
+      }
+      if(strncmp(pos, name, len)==0 && (pos[len]==',' || !pos[len]))
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cmp_long_long()
+//
+//   Comparison function for qsort().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int cmp_long_long(const void* p1, const void* p2)
+{
+   long long v1 = *(const long long*)p1, v2 = *(const long long*)p2;
+
+   return (v1>v2)-(v1<v2);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: run_kernel()
+//
+//   Run a kernel repeat times and print the result line. Times are
+//   given per operation, based on the best and the median run.
+//
+// Global Variables: repeat
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void run_kernel(FILE* out, Kernel_p kernel, Workload_p wl)
+{
+   KernelResCell res;
+   long long     *times = SizeMalloc(repeat*sizeof(long long));
+   double        best, median;
+   long          i;
+
+   for(i=0; i<repeat; i++)
+   {
+      res.ops     = 0;
+      res.results = 0;
+      res.ns      = 0;
+      res.storage = 0;
+      kernel->fun(wl, &res);
+      times[i] = res.ns;
+   }
+   qsort(times, repeat, sizeof(long long), cmp_long_long);
+   if(!res.ops)
+   {
+      fprintf(out, "%-10s %10s   (no operations: %s)\n",
+              kernel->name, "0", kernel->desc);
+   }
+   else
+   {
+      best   = (double)times[0]/res.ops;
+      median = (double)times[repeat/2]/res.ops;
+      fprintf(out, "%-10s %10ld %10ld %12.1f %12.1f %10.3f %12ld\n",
+              kernel->name, res.ops, res.results, best, median,
+              best>0.0?1000.0/best:0.0, res.storage);
+   }
+   SizeFree(times, repeat*sizeof(long long));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: main()
+//
+//   Entry point of the program and driver of the processing.
+//
+// Global Variables: All declared in this file
+//
+// Side Effects    : Yes ;-)
+//
+/----------------------------------------------------------------------*/
+
+int main(int argc, char* argv[])
+{
+   TB_p          terms;
+   GCAdmin_p     collector;
+   VarBank_p     freshvars;
+   TypeBank_p    typebank;
+   Sig_p         sig;
+   FormulaSet_p  formulas, f_ax_archive;
+   Scanner_p     in;
+   int           i;
+   CLState_p     state;
+   StrTree_p     skip_includes = NULL;
+   WorkloadCell  wl;
+   Kernel_p      kernel;
+
+   assert(argv[0]);
+   InitIO(NAME);
+
+   state = process_options(argc, argv);
+
+   OpenGlobalOut(outname);
+
+   if(state->argc ==  0)
+   {
+      CLStateInsertArg(state, "-");
+   }
+
+   typebank     = TypeBankAlloc();
+   sig          = SigAlloc(typebank);
+   SigInsertInternalCodes(sig);
+   terms        = TBAlloc(sig);
+   collector    = GCAdminAlloc(terms);
+   wl.bank      = terms;
+   wl.clauses   = ClauseSetAlloc();
+   formulas     = FormulaSetAlloc();
+   f_ax_archive = FormulaSetAlloc();
+
+   GCRegisterClauseSet(collector, wl.clauses);
+   GCRegisterFormulaSet(collector, formulas);
+   GCRegisterFormulaSet(collector, f_ax_archive);
+
+   for(i=0; state->argv[i]; i++)
+   {
+      in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL);
+      ScannerSetFormat(in, parse_format);
+      FormulaAndClauseSetParse(in, formulas, wl.clauses, terms,
+                               NULL, &skip_includes);
+      CheckInpTok(in, NoToken);
+      DestroyScanner(in);
+   }
+   CLStateFree(state);
+
+   freshvars = VarBankAlloc(typebank);
+   FormulaSetCNF2(formulas, f_ax_archive, wl.clauses, terms, freshvars,
+                  collector, 1000);
+   VarBankFree(freshvars);
+
+   GCDeregisterFormulaSet(collector, formulas);
+   FormulaSetFree(formulas);
+   GCDeregisterFormulaSet(collector, f_ax_archive);
+   FormulaSetFree(f_ax_archive);
+
+   workload_init(&wl);
+
+   fprintf(GlobalOut,
+           "# Workload: %ld clauses, %ld literal sides, %ld subterms, "
+           "%ld shared term cells (%ld bytes)\n",
+           wl.clauses->members,
+           PStackGetSP(wl.terms),
+           PStackGetSP(wl.subterms),
+           TBNonVarTermNodes(terms),
+           TBNonVarTermNodes(terms)*(long)sizeof(TermCell));
+   fprintf(GlobalOut, "# Window: %ld, repetitions: %ld\n", window, repeat);
+   fprintf(GlobalOut, "# %-8s %10s %10s %12s %12s %10s %12s\n",
+           "Kernel", "Ops", "Results", "Best ns/op", "Median ns/op",
+           "Mops/s", "Storage");
+   for(kernel = kernels; kernel->name; kernel++)
+   {
+      if(kernel_selected(kernel->name))
+      {
+         run_kernel(GlobalOut, kernel, &wl);
+         fflush(GlobalOut);
+      }
+   }
+
+   workload_exit(&wl);
+
+#ifndef FAST_EXIT
+   GCDeregisterClauseSet(collector, wl.clauses);
+   ClauseSetFree(wl.clauses);
+   GCAdminFree(collector);
+
+   terms->sig = NULL;
+   TBFree(terms);
+   SigFree(sig);
+   TypeBankFree(typebank);
+#endif
+
+   OutClose(GlobalOut);
+   ExitIO();
+
+#ifdef CLB_MEMORY_DEBUG
+   RegMemCleanUp();
+   MemFlushFreeList();
+   MemDebugPrintStats(stdout);
+#endif
+
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, all options
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg, *pos;
+   size_t len;
+   Kernel_p kernel;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+            Verbose = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_VERSION:
+            printf(NAME " " VERSION "\n");
+            exit(NO_ERROR);
+      case OPT_OUTPUT:
+            outname = arg;
+            break;
+      case OPT_REPEAT:
+            repeat = CLStateGetIntArg(handle, arg);
+            if(repeat < 1)
+            {
+               Error("Option -r (--repeat) requires a positive argument",
+                     USAGE_ERROR);
+            }
+            break;
+      case OPT_WINDOW:
+            window = CLStateGetIntArg(handle, arg);
+            if(window < 1)
+            {
+               Error("Option -w (--window) requires a positive argument",
+                     USAGE_ERROR);
+            }
+            break;
+      case OPT_KERNELS:
+            kernel_names = arg;
+            break;
+      case OPT_FP_INDEX:
+            if(!GetFPIndexFunction(arg))
+            {
+               Error("Option --fp-index requires a fingerprint function "
+                     "name (e.g. FP7)", USAGE_ERROR);
+            }
+            fp_index = arg;
+            break;
+      case OPT_LOP_PARSE:
+            parse_format = LOPFormat;
+            break;
+      case OPT_TPTP_PARSE:
+            parse_format = TPTPFormat;
+            break;
+      case OPT_TSTP_PARSE:
+            parse_format = TSTPFormat;
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   /* Make sure all selected kernels exist */
+   for(pos = kernel_names; pos; pos = strchr(pos, ','))
+   {
+      if(*pos == ',')
+      {
+         pos++;
+      }
+      len = strcspn(pos, ",");
+      for(kernel = kernels; kernel->name; kernel++)
+      {
+         if(strlen(kernel->name)==len && strncmp(kernel->name, pos, len)==0)
+         {
+            break;
+         }
+      }
+      if(!kernel->name)
+      {
+         Error("Unknown kernel in %s", USAGE_ERROR, kernel_names);
+      }
+   }
+   return state;
+}
+
+void print_help(FILE* out)
+{
+   Kernel_p kernel;
+
+   fprintf(out, "\n\
+\n"
+NAME " " VERSION "\n\
+\n\
+Usage: " NAME " [options] [files]\n\
+\n\
+Read a clause stream (e.g. recorded with eprover\n\
+--record-given-clauses=<file>) and replay it through the core\n\
+kernels of E. For each kernel, the number of operations and\n\
+successful operations (results), the best and median time per\n\
+operation, the throughput, and the size of the data structure the\n\
+kernel works on (storage, if known) are printed.\n\
+\n\
+Kernels:\n\
+\n");
+   for(kernel = kernels; kernel->name; kernel++)
+   {
+      fprintf(out, "   %-10s %s\n", kernel->name, kernel->desc);
+   }
+   fprintf(out, "\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
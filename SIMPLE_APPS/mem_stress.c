@@ -0,0 +1,644 @@
+/*-----------------------------------------------------------------------
+
+File  : mem_stress.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Multi-threaded stress test for the free list depot of
+  clb_memory.c. Pairs of threads pass blocks of various sizes through
+  a queue: The producer of each pair allocates and stamps blocks, the
+  consumer checks the stamp and frees the block. The free lists of
+  the consumers overflow and are drained into the depot, the empty
+  lists of the producers are refilled from it. Each round starts new
+  threads, so that MemThreadExit() hands the remaining free lists of
+  the last round to the depot. At the end, the depot is checked for
+  consistency (counts, byte total, duplicate or overlapping blocks).
+  The program exits with a non-zero status if any check fails.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 11:37:21 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <pthread.h>
+#include <cio_commandline.h>
+#include <cio_initio.h>
+#include <e_version.h>
+
+
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+#define NAME "mem_stress"
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERSION,
+   OPT_VERBOSE,
+   OPT_PAIRS,
+   OPT_BLOCKS,
+   OPT_ROUNDS
+}OptionCodes;
+
+/* Blocks in flight between the producer and the consumer of a
+   pair. Much larger than MEM_THREAD_CACHE_MAX, so that the lists of
+   the consumer overflow. */
+
+#define QUEUE_SIZE 4096
+
+/* Written by the consumer into the last word of a block before it is
+   freed, so that the producer can recognize recycled blocks. */
+
+#define DEAD_STAMP 0xDEADBEEFDEADBEEFUL
+
+typedef struct pairqueuecell
+{
+   pthread_mutex_t lock;
+   pthread_cond_t  not_empty;
+   pthread_cond_t  not_full;
+   long            head;
+   long            tail;
+   void            *blocks[QUEUE_SIZE];
+}PairQueueCell, *PairQueue_p;
+
+typedef struct paircell
+{
+   long          id;
+   long          round;
+   PairQueueCell queue;
+   pthread_t     producer;
+   pthread_t     consumer;
+   long          recycled;  /* Blocks the producer got back */
+}PairCell, *Pair_p;
+
+typedef struct depotblockcell
+{
+   char *addr;
+   long size;
+}DepotBlockCell;
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+
+   {OPT_VERSION,
+    '\0', "version",
+    NoArg, NULL,
+    "Print the version number of the program."},
+
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program by printing "
+    "technical information to stderr."},
+
+   {OPT_PAIRS,
+    'p', "pairs",
+    ReqArg, NULL,
+    "Number of producer/consumer pairs of threads. The default is 4."},
+
+   {OPT_BLOCKS,
+    'n', "blocks",
+    ReqArg, NULL,
+    "Number of blocks each producer allocates per round. The default "
+    "is 200000."},
+
+   {OPT_ROUNDS,
+    'r', "rounds",
+    ReqArg, NULL,
+    "Number of rounds, each with a fresh set of threads. The default "
+    "is 4."},
+
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+long pairs  = 4;
+long blocks = 200000;
+long rounds = 4;
+
+/* Block sizes. All are multiples of the word size and large enough
+   for the free list header plus the DEAD_STAMP word. */
+
+static const size_t block_sizes[] =
+{
+   32, 40, 48, 64, 96, 128, 200, 512, 1024, 4000
+};
+
+#define BLOCK_SIZE_NO (sizeof(block_sizes)/sizeof(size_t))
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: block_size()
+//
+//   Return the size of block seq of pair id.
+//
+// Global Variables: block_sizes
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static size_t block_size(long id, long seq)
+{
+   return block_sizes[(seq*7+id)%BLOCK_SIZE_NO];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: block_stamp()
+//
+//   Return the stamp of block seq of pair id in round round. Word i
+//   of the block holds stamp+i.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static unsigned long block_stamp(long id, long round, long seq)
+{
+   return ((unsigned long)round<<56)^((unsigned long)id<<40)^
+      ((unsigned long)seq*2654435761UL);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: queue_put()
+//
+//   Append block to the queue, waiting while it is full.
+//
+// Global Variables: -
+//
+// Side Effects    : Synchronization
+//
+/----------------------------------------------------------------------*/
+
+static void queue_put(PairQueue_p queue, void *block)
+{
+   pthread_mutex_lock(&queue->lock);
+   while(queue->tail-queue->head == QUEUE_SIZE)
+   {
+      pthread_cond_wait(&queue->not_full, &queue->lock);
+   }
+   queue->blocks[queue->tail%QUEUE_SIZE] = block;
+   queue->tail++;
+   pthread_cond_signal(&queue->not_empty);
+   pthread_mutex_unlock(&queue->lock);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: queue_get()
+//
+//   Remove and return the first block of the queue, waiting while it
+//   is empty.
+//
+// Global Variables: -
+//
+// Side Effects    : Synchronization
+//
+/----------------------------------------------------------------------*/
+
+static void* queue_get(PairQueue_p queue)
+{
+   void *block;
+
+   pthread_mutex_lock(&queue->lock);
+   while(queue->tail == queue->head)
+   {
+      pthread_cond_wait(&queue->not_empty, &queue->lock);
+   }
+   block = queue->blocks[queue->head%QUEUE_SIZE];
+   queue->head++;
+   pthread_cond_signal(&queue->not_full);
+   pthread_mutex_unlock(&queue->lock);
+
+   return block;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: producer()
+//
+//   Allocate and stamp the blocks of one round and pass them to the
+//   consumer. Count the blocks that were freed by a consumer before
+//   (and hence came via the depot).
+//
+// Global Variables: blocks
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void* producer(void *arg)
+{
+   Pair_p        pair = arg;
+   unsigned long *block, stamp;
+   size_t        size, words, i;
+   long          seq;
+
+   MemThreadInit();
+   for(seq=0; seq<blocks; seq++)
+   {
+      size  = block_size(pair->id, seq);
+      words = size/sizeof(unsigned long);
+      block = SizeMalloc(size);
+      if(block[words-1] == DEAD_STAMP)
+      {
+         pair->recycled++;
+      }
+      stamp = block_stamp(pair->id, pair->round, seq);
+      for(i=0; i<words; i++)
+      {
+         block[i] = stamp+i;
+      }
+      queue_put(&pair->queue, block);
+   }
+   MemThreadExit();
+
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: consumer()
+//
+//   Receive the blocks of one round in order, check their stamps and
+//   free them. Terminate the program if a block has been modified
+//   while in flight (i.e. it has been handed out twice).
+//
+// Global Variables: blocks
+//
+// Side Effects    : Memory operations, may terminate the program
+//
+/----------------------------------------------------------------------*/
+
+static void* consumer(void *arg)
+{
+   Pair_p        pair = arg;
+   unsigned long *block, stamp;
+   size_t        size, words, i;
+   long          seq;
+
+   MemThreadInit();
+   for(seq=0; seq<blocks; seq++)
+   {
+      size  = block_size(pair->id, seq);
+      words = size/sizeof(unsigned long);
+      block = queue_get(&pair->queue);
+      stamp = block_stamp(pair->id, pair->round, seq);
+      for(i=0; i<words; i++)
+      {
+         if(block[i] != stamp+i)
+         {
+            Error("Pair %ld, round %ld: Block %ld (%p, %zd bytes) "
+                  "corrupted at word %zd", OTHER_ERROR,
+                  pair->id, pair->round, seq, (void*)block, size, i);
+         }
+      }
+      block[words-1] = DEAD_STAMP;
+      SizeFree(block, size);
+   }
+   MemThreadExit();
+
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: block_cmp()
+//
+//   Compare two depot blocks by address for qsort().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int block_cmp(const void *b1, const void *b2)
+{
+   const char *a1 = ((const DepotBlockCell*)b1)->addr;
+   const char *a2 = ((const DepotBlockCell*)b2)->addr;
+
+   return (a1 > a2) - (a1 < a2);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: depot_check()
+//
+//   Check the depot: The lists have to agree with the block counts
+//   and the byte total, and no two blocks may overlap. Return the
+//   number of blocks in the depot, terminate the program if the depot
+//   is inconsistent.
+//
+// Global Variables: MemDepot
+//
+// Side Effects    : Memory operations, may terminate the program
+//
+/----------------------------------------------------------------------*/
+
+static long depot_check(void)
+{
+   DepotBlockCell *found;
+   Mem_p          handle;
+   long           f, count, bytes = 0, total = 0, i;
+
+   for(f=MEM_ARR_MIN_INDEX; f<MEM_ARR_SIZE; f++)
+   {
+      total += MemDepot.count[f];
+   }
+   found = SecureMalloc((total+1)*sizeof(DepotBlockCell));
+
+   i = 0;
+   for(f=MEM_ARR_MIN_INDEX; f<MEM_ARR_SIZE; f++)
+   {
+      count = 0;
+      for(handle = MemDepot.list[f];
+          handle && count <= MemDepot.count[f];
+          handle = handle->next)
+      {
+         assert(handle->test == MEM_FREE_PATTERN);
+         if(count < MemDepot.count[f])
+         {
+            found[i].addr = (char*)handle;
+            found[i].size = f;
+            i++;
+         }
+         count++;
+      }
+      if(count != MemDepot.count[f])
+      {
+         Error("Depot list for size %ld does not hold %ld blocks",
+               OTHER_ERROR, f, MemDepot.count[f]);
+      }
+      bytes += count*f;
+   }
+   if(bytes != MemDepot.bytes)
+   {
+      Error("Depot lists hold %ld bytes, total is %ld",
+            OTHER_ERROR, bytes, MemDepot.bytes);
+   }
+
+   qsort(found, total, sizeof(DepotBlockCell), block_cmp);
+   for(i=1; i<total; i++)
+   {
+      if(found[i-1].addr+found[i-1].size > found[i].addr)
+      {
+         Error("Depot blocks %p (%ld bytes) and %p overlap", OTHER_ERROR,
+               (void*)found[i-1].addr, found[i-1].size,
+               (void*)found[i].addr);
+      }
+   }
+   FREE(found);
+
+   return total;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: run_round()
+//
+//   Run one round with fresh threads. Return the number of recycled
+//   blocks.
+//
+// Global Variables: pairs
+//
+// Side Effects    : Memory operations, starts and joins threads
+//
+/----------------------------------------------------------------------*/
+
+static long run_round(long round)
+{
+   Pair_p pair_arr = SecureMalloc(pairs*sizeof(PairCell));
+   long   i, recycled = 0;
+
+   for(i=0; i<pairs; i++)
+   {
+      pair_arr[i].id       = i;
+      pair_arr[i].round    = round;
+      pair_arr[i].recycled = 0;
+      pair_arr[i].queue.head = 0;
+      pair_arr[i].queue.tail = 0;
+      pthread_mutex_init(&pair_arr[i].queue.lock, NULL);
+      pthread_cond_init(&pair_arr[i].queue.not_empty, NULL);
+      pthread_cond_init(&pair_arr[i].queue.not_full, NULL);
+   }
+   for(i=0; i<pairs; i++)
+   {
+      if(pthread_create(&pair_arr[i].producer, NULL, producer, &pair_arr[i])||
+         pthread_create(&pair_arr[i].consumer, NULL, consumer, &pair_arr[i]))
+      {
+         SysError("Cannot start threads", SYS_ERROR);
+      }
+   }
+   for(i=0; i<pairs; i++)
+   {
+      pthread_join(pair_arr[i].producer, NULL);
+      pthread_join(pair_arr[i].consumer, NULL);
+      recycled += pair_arr[i].recycled;
+      pthread_mutex_destroy(&pair_arr[i].queue.lock);
+      pthread_cond_destroy(&pair_arr[i].queue.not_empty);
+      pthread_cond_destroy(&pair_arr[i].queue.not_full);
+   }
+   FREE(pair_arr);
+
+   return recycled;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+int main(int argc, char* argv[])
+{
+   CLState_p state;
+   long      round, recycled = 0, depot_blocks = 0;
+
+   assert(argv[0]);
+   InitIO(NAME);
+
+   state = process_options(argc, argv);
+   if(state->argc)
+   {
+      Error("No file arguments expected", USAGE_ERROR);
+   }
+   CLStateFree(state);
+
+   for(round=0; round<rounds; round++)
+   {
+      recycled += run_round(round);
+      if(MemThreadsActive())
+      {
+         Error("%d threads still registered after round %ld",
+               OTHER_ERROR, MemThreadsActive(), round);
+      }
+      depot_blocks = depot_check();
+      if(Verbose)
+      {
+         fprintf(stderr, "%s: Round %ld done, %ld blocks in the depot\n",
+                 ProgName, round, depot_blocks);
+      }
+   }
+   if(rounds > 1 && !recycled)
+   {
+      Error("No block was refilled from the depot", OTHER_ERROR);
+   }
+   printf("# %ld rounds, %ld pairs, %ld blocks each: %ld blocks "
+          "recycled via the depot, %ld blocks in the depot\n",
+          rounds, pairs, blocks, recycled, depot_blocks);
+
+   MemFlushFreeList();
+   if(MemDepot.bytes)
+   {
+      Error("Depot still holds %ld bytes after flushing",
+            OTHER_ERROR, MemDepot.bytes);
+   }
+   ExitIO();
+
+#ifdef CLB_MEMORY_DEBUG
+   MemDebugPrintStats(stdout);
+#endif
+
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, all options
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+            Verbose = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_VERSION:
+            printf(NAME " " VERSION "\n");
+            exit(NO_ERROR);
+      case OPT_PAIRS:
+            pairs = CLStateGetIntArg(handle, arg);
+            if(pairs < 1)
+            {
+               Error("Option -p (--pairs) requires a positive argument",
+                     USAGE_ERROR);
+            }
+            break;
+      case OPT_BLOCKS:
+            blocks = CLStateGetIntArg(handle, arg);
+            if(blocks < 1)
+            {
+               Error("Option -n (--blocks) requires a positive argument",
+                     USAGE_ERROR);
+            }
+            break;
+      case OPT_ROUNDS:
+            rounds = CLStateGetIntArg(handle, arg);
+            if(rounds < 1)
+            {
+               Error("Option -r (--rounds) requires a positive argument",
+                     USAGE_ERROR);
+            }
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n"
+NAME " " VERSION "\n\
+\n\
+Usage: " NAME " [options]\n\
+\n\
+Stress test for the thread-safe free list management. Pairs of\n\
+threads allocate blocks of various sizes, pass them on and free\n\
+them in the other thread, so that blocks move between the threads\n\
+via the shared depot. The blocks and the depot are checked for\n\
+consistency, a failed check terminates the program with a non-zero\n\
+exit status.\n\
+\n");
+   PrintOptions(stdout, opts, "Options:\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -20,6 +20,8 @@ Changes
 
 <1> Wed Mar 11 16:17:33 MET 1998
     New
+<2> Mon Oct 19 09:29:58 CEST 2026
+    Prune the occur check with variable masks of shared terms
 
 -----------------------------------------------------------------------*/
 
@@ -90,7 +92,10 @@ static __inline__ bool reorientation_needed(Term_p t1, Term_p t2)
 // Function: occur_check()
 //
 //   Occur check for variables, possibly more efficient than the
-//   general TermIsSubterm()
+//   general TermIsSubterm(). unsafe has to cover the variable masks
+//   of var and of all bound variables - shared subterms without any
+//   of these cannot contain var even after dereferencing and are
+//   skipped.
 //
 // Global Variables: -
 //
@@ -98,7 +103,8 @@ static __inline__ bool reorientation_needed(Term_p t1, Term_p t2)
 //
 /----------------------------------------------------------------------*/
 
-static bool occur_check(restrict Term_p term, restrict Term_p var)
+static bool occur_check(restrict Term_p term, restrict Term_p var,
+                        VarMask unsafe)
 {
    term = TermDerefAlways(term);
 
@@ -106,10 +112,14 @@ static bool occur_check(restrict Term_p term, restrict Term_p var)
    {
       return true;
    }
+   if(TermIsShared(term) && !(term->var_mask & unsafe))
+   {
+      return false;
+   }
 
    for(int i=0; i < term->arity; i++)
    {
-      if(occur_check(term->args[i], var))
+      if(occur_check(term->args[i], var, unsafe))
       {
          return true;
       }
@@ -119,6 +129,30 @@ static bool occur_check(restrict Term_p term, restrict Term_p var)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: subst_var_mask()
+//
+//   Return the variable mask of the variables bound in subst.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static VarMask subst_var_mask(Subst_p subst)
+{
+   VarMask res = 0;
+
+   for(PStackPointer i=0; i<PStackGetSP(subst); i++)
+   {
+      res |= VarMaskBit(((Term_p)PStackElementP(subst, i))->f_code);
+   }
+   return res;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -180,7 +214,7 @@ int PartiallyMatchVar(Term_p var_matcher, Term_p to_match, Sig_p sig,
    {
       for(int i=0; i<args_to_eat + TermIsAppliedVar(to_match) ? 1 : 0; i++)
       {
-         if(occur_check(to_match->args[i], var_matcher))
+         if(occur_check(to_match->args[i], var_matcher, ~(VarMask)0))
          {
             return MATCH_FAILED;
          }
@@ -472,6 +506,7 @@ bool SubstComputeMgu(Term_p t1, Term_p t2, Subst_p subst)
 
    }
    PStackPointer backtrack = PStackGetSP(subst); /* For backtracking */
+   VarMask bound = subst_var_mask(subst);
 
    bool res = true;
    PQueue_p jobs = PQueueAlloc();
@@ -496,7 +531,8 @@ bool SubstComputeMgu(Term_p t1, Term_p t2, Subst_p subst)
             assert(t1->type);
             assert(t2->type);
             /* Sort check and occur check - remember, variables are elementary and shared! */
-            if((t1->type != t2->type) || occur_check(t2, t1))
+            if((t1->type != t2->type) ||
+               occur_check(t2, t1, bound|VarMaskBit(t1->f_code)))
             {
                res = false;
                break;
@@ -504,6 +540,7 @@ bool SubstComputeMgu(Term_p t1, Term_p t2, Subst_p subst)
             else
             {
                SubstAddBinding(subst, t1, t2);
+               bound |= VarMaskBit(t1->f_code);
             }
          }
       }
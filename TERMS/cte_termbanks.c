@@ -149,37 +149,55 @@ static Term_p tb_termtop_insert(TB_p bank, Term_p t)
    }
    bank->insertions++;
 
-   new = TermCellStoreInsert(&(bank->term_store), t);
+   new = TermCellStoreFind(&(bank->term_store), t);
 
    if(new) /* Term node already existed, just add properties */
    {
       assert(!TermIsShared(t));
+      if(UNLIKELY(TBGCYoungRunning(bank)))
+      {
+         TBGCMarkYoungTerm(bank, new);
+      }
       new->properties = (new->properties | t->properties)/*& bank->prop_mask*/;
       TermTopFree(t);
       t = new;
    }
    else
    {
+      t = TermTopInlineArgs(t);
+      TermCellStoreAdd(&(bank->term_store), t);
       t->entry_no     = ++(bank->in_count);
       TermCellAssignProp(t,TPGarbageFlag, bank->garbage_state);
+      if(UNLIKELY(bank->gc_young))
+      {
+         PStackPushP(bank->gc_young, t);
+         if(TBGCYoungRunning(bank))
+         {
+            /* The new cell survives the running collection, and so
+               have its arguments */
+            for(int i=0; i<t->arity; i++)
+            {
+               TBGCMarkYoungTerm(bank, t->args[i]);
+            }
+         }
+      }
       TermCellSetProp(t, TPIsShared); /* Groundness may change below */
       t->v_count = 0;
       t->f_count = !TermIsAppliedVar(t) ? 1 : 0;
-      t->weight = DEFAULT_FWEIGHT*t->f_count;
+      t->var_mask = 0;
       for(int i=0; i<t->arity; i++)
       {
          assert(TermIsShared(t->args[i])||TermIsVar(t->args[i]));
          if(TermIsVar(t->args[i]))
          {
             t->v_count += 1;
-            t->weight  += DEFAULT_VWEIGHT;
          }
          else
          {
             t->v_count +=t->args[i]->v_count;
             t->f_count +=t->args[i]->f_count;
-            t->weight  +=t->args[i]->weight;
          }
+         t->var_mask |= t->args[i]->var_mask;
       }
 
       if(t->v_count == 0)
@@ -189,6 +207,7 @@ static Term_p tb_termtop_insert(TB_p bank, Term_p t)
 
       assert(TermWeight(t, DEFAULT_VWEIGHT, DEFAULT_FWEIGHT) == TermWeightCompute(t, DEFAULT_VWEIGHT, DEFAULT_FWEIGHT));
       assert((t->v_count == 0) == TermIsGround(t));
+      assert((t->v_count == 0) == (t->var_mask == 0));
       assert(TBFind(bank, t));
       //assert(TermIsGround(t) == TermIsGroundCompute(t));
    }
@@ -545,6 +564,13 @@ TB_p TBAlloc(Sig_p sig)
    handle->rewrite_steps = 0;
    handle->ext_index = PDIntArrayAlloc(1,100000);
    handle->garbage_state = TPIgnoreProps;
+   handle->gc_young_start = 0;
+   handle->gc_mark_limit = LONG_MAX;
+   handle->gc_young = NULL;
+   handle->gc_sweep_pos = 0;
+   handle->gc_sweep_keep = 0;
+   handle->gc_remembered = NULL;
+   handle->gc_rw_roots = NULL;
    handle->sig = sig;
    handle->vars = VarBankAlloc(sig->type_bank);
    TermCellStoreInit(&(handle->term_store));
@@ -585,6 +611,12 @@ void TBFree(TB_p junk)
    /* printf("TBFree(): %ld\n", TermCellStoreNodes(&(junk->term_store)));
     */
    TermCellStoreExit(&(junk->term_store));
+   if(junk->gc_young)
+   {
+      PStackFree(junk->gc_young);
+      PStackFree(junk->gc_remembered);
+      PStackFree(junk->gc_rw_roots);
+   }
    PDArrayFree(junk->ext_index);
    VarBankFree(junk->vars);
 
@@ -1086,11 +1118,18 @@ Term_p TBAllocNewSkolem(TB_p bank, PStack_p variables, Type_p ret_type)
 
 Term_p TBFind(TB_p bank, Term_p term)
 {
+   Term_p res;
+
    if(TermIsVar(term))
    {
       return VarBankFCodeFind(bank->vars, term->f_code);
    }
-   return TermCellStoreFind(&(bank->term_store), term);
+   res = TermCellStoreFind(&(bank->term_store), term);
+   if(UNLIKELY(res && TBGCYoungRunning(bank)))
+   {
+      TBGCMarkYoungTerm(bank, res);
+   }
+   return res;
 }
 
 
@@ -1110,19 +1149,18 @@ void TBPrintBankInOrder(FILE* out, TB_p bank)
 {
    NumTree_p tree = NULL;
    long i;
-   PStack_p stack;
    Term_p   cell;
    IntOrP   dummy;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(&(bank->term_store)); i++)
    {
-      stack = TermTreeTraverseInit(bank->term_store.store[i]);
-      while((cell = TermTreeTraverseNext(stack)))
+      for(cell = TermCellStoreBucket(&(bank->term_store), i);
+          cell;
+          cell = cell->chain)
       {
          dummy.p_val = cell;
          NumTreeStore(&tree, cell->entry_no,dummy, dummy);
       }
-      TermTreeTraverseExit(stack);
    }
    tb_print_dag(out, tree, bank->sig);
    NumTreeFree(tree);
@@ -1221,30 +1259,22 @@ void TBPrintTerm(FILE* out, TB_p bank, Term_p term, bool fullterms)
 
 void TBPrintBankTerms(FILE* out, TB_p bank)
 {
-   PStack_p stack = PStackAlloc();
    Term_p term;
-   int i;
+   long i;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(&(bank->term_store)); i++)
    {
-      PStackPushP(stack, bank->term_store.store[i]);
-
-      while(!PStackEmpty(stack))
+      for(term = TermCellStoreBucket(&(bank->term_store), i);
+          term;
+          term = term->chain)
       {
-         term = PStackPopP(stack);
-         if(term)
+         if(TermCellQueryProp(term, TPTopPos))
          {
-            PStackPushP(stack, term->lson);
-            PStackPushP(stack, term->rson);
-            if(TermCellQueryProp(term, TPTopPos))
-            {
-               TBPrintTermCompact(out, bank, term);
-               fprintf(out, "\n");
-            }
+            TBPrintTermCompact(out, bank, term);
+            fprintf(out, "\n");
          }
       }
    }
-   PStackFree(stack);
 }
 
 
@@ -1642,6 +1672,7 @@ long TBGCSweep(TB_p bank)
 
    assert(bank);
    assert(!TermIsRewritten(bank->true_term));
+   assert(!TBGCYoungRunning(bank));
    TBGCMarkTerm(bank, bank->true_term);
    TBGCMarkTerm(bank, bank->false_term);
    if(bank->min_term)
@@ -1664,11 +1695,347 @@ long TBGCSweep(TB_p bank)
 #endif
    bank->garbage_state =
       bank->garbage_state?TPIgnoreProps:TPGarbageFlag;
+   bank->gc_young_start = bank->in_count;
+   if(bank->gc_young)
+   {
+      PStackReset(bank->gc_young);
+      PStackReset(bank->gc_remembered);
+   }
 
    return recovered;
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCStartGenerations()
+//
+//   Start tracking the cells created from now on as the young
+//   generation, so that young collections can be used. All existing
+//   cells are considered old.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void TBGCStartGenerations(TB_p bank)
+{
+   assert(!TBGCYoungRunning(bank));
+
+   if(!bank->gc_young)
+   {
+      bank->gc_young      = PStackAlloc();
+      bank->gc_remembered = PStackAlloc();
+      bank->gc_rw_roots   = PStackAlloc();
+   }
+   bank->gc_young_start = bank->in_count;
+   PStackReset(bank->gc_young);
+   PStackReset(bank->gc_remembered);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCMarkYoungTerm()
+//
+//   Mark the collectable young cells reachable from term. Old cells
+//   are neither marked nor traversed, since their arguments are
+//   older still. Cells created during a running collection are not
+//   traversed either, their young arguments have been marked at
+//   creation.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks the term, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void TBGCMarkYoungTerm(TB_p bank, Term_p term)
+{
+   PStack_p stack;
+   int i;
+
+   assert(bank);
+   assert(term);
+
+   if(!TBTermCellIsCollectable(bank, term) ||
+      TBTermCellIsMarked(bank,term))
+   {
+      return;
+   }
+   stack = PStackAlloc();
+   PStackPushP(stack, term);
+   while(!PStackEmpty(stack))
+   {
+      term = PStackPopP(stack);
+      if(TBTermCellIsCollectable(bank, term) &&
+         !TBTermCellIsMarked(bank,term))
+      {
+         TermCellFlipProp(term, TPGarbageFlag);
+         for(i=0; i<term->arity; i++)
+         {
+            PStackPushP(stack, term->args[i]);
+         }
+         if(TermIsRewritten(term))
+         {
+            PStackPushP(stack, TermRWReplaceField(term));
+         }
+      }
+   }
+   PStackFree(stack);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCYoungStart()
+//
+//   Start a young collection that can be run in bounded steps. The
+//   current young generation is collected, cells created from now
+//   on survive. Until TBGCYoungStop(), the bank marks all cells it
+//   hands out (found on insertion or being arguments of new cells)
+//   and the source and target of new rewrite links, the caller has
+//   to mark everything else that is reachable (first with
+//   TBGCYoungMarkRWStep(), then e.g. via GCCollectIncremental()).
+//   Marks the special terms.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks terms, changes the behaviour of the bank
+//
+/----------------------------------------------------------------------*/
+
+void TBGCYoungStart(TB_p bank)
+{
+   PStack_p tmp;
+
+   assert(bank->gc_young);
+   assert(!TBGCYoungRunning(bank));
+   assert(PStackEmpty(bank->gc_rw_roots));
+
+   bank->gc_mark_limit = bank->in_count;
+   bank->gc_sweep_pos  = PStackGetSP(bank->gc_young);
+   bank->gc_sweep_keep = bank->gc_sweep_pos;
+   tmp = bank->gc_rw_roots;
+   bank->gc_rw_roots   = bank->gc_remembered;
+   bank->gc_remembered = tmp;
+
+   TBGCMarkYoungTerm(bank, bank->true_term);
+   TBGCMarkYoungTerm(bank, bank->false_term);
+   if(bank->min_term)
+   {
+      TBGCMarkYoungTerm(bank, bank->min_term);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCYoungMarkRWStep()
+//
+//   Mark the targets of up to budget rewrite links remembered before
+//   the running young collection. This includes links from cells
+//   that turn out to be garbage: Such a cell can still be found again
+//   by an insertion before it is swept, and its target may be older
+//   than itself. Returns the unused budget, which is positive only
+//   if all remembered links have been marked.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks terms
+//
+/----------------------------------------------------------------------*/
+
+long TBGCYoungMarkRWStep(TB_p bank, long budget)
+{
+   Term_p term;
+
+   assert(TBGCYoungRunning(bank));
+
+   while(budget && !PStackEmpty(bank->gc_rw_roots))
+   {
+      term = PStackPopP(bank->gc_rw_roots);
+      if(TermIsRewritten(term))
+      {
+         TBGCMarkYoungTerm(bank, TermRWReplaceField(term));
+      }
+      budget--;
+   }
+   return budget;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCYoungSweepStep()
+//
+//   After marking of a young collection is complete, free up to
+//   budget unmarked cells of the collected generation, newest
+//   first. A cell is always freed before its arguments, so a
+//   garbage cell that is found again by an insertion before it is
+//   swept never refers to freed (and possibly reused) memory. The
+//   survivors are moved up to the end of the collected part of
+//   bank->gc_young and stay marked until TBGCYoungStop(). Returns
+//   the number of term cells recovered.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long TBGCYoungSweepStep(TB_p bank, long budget)
+{
+   long recovered = 0;
+   Term_p term;
+
+   assert(TBGCYoungRunning(bank));
+
+   while(budget-- && !TBGCYoungSweepDone(bank))
+   {
+      bank->gc_sweep_pos--;
+      term = PStackElementP(bank->gc_young, bank->gc_sweep_pos);
+      if(TBTermCellIsMarked(bank, term))
+      {
+         bank->gc_sweep_keep--;
+         PStackAssignP(bank->gc_young, bank->gc_sweep_keep, term);
+      }
+      else
+      {
+         TermCellStoreDelete(&(bank->term_store), term);
+         recovered++;
+      }
+   }
+   return recovered;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCYoungSweepDone()
+//
+//   Return true if all cells collected by the running young
+//   collection have been swept.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool TBGCYoungSweepDone(TB_p bank)
+{
+   return bank->gc_sweep_pos == 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCYoungStop()
+//
+//   End the running young collection and remove all marks. If it is
+//   complete, the survivors become old. Otherwise they and the
+//   unswept cells stay young. Cells created during the collection
+//   join the new young generation. Rewrite links are remembered only
+//   where they still point to a young cell.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void TBGCYoungStop(TB_p bank)
+{
+   PStackPointer i, j;
+   Term_p term;
+
+   assert(TBGCYoungRunning(bank));
+
+   for(i=0; i<bank->gc_sweep_pos; i++)
+   {
+      term = PStackElementP(bank->gc_young, i);
+      if(TBTermCellIsMarked(bank, term))
+      {
+         TermCellFlipProp(term, TPGarbageFlag);
+      }
+   }
+   for(i=bank->gc_sweep_keep, j=bank->gc_sweep_pos;
+       i<PStackGetSP(bank->gc_young); i++)
+   {
+      term = PStackElementP(bank->gc_young, i);
+      if(TBTermCellIsCollectable(bank, term))
+      {
+         /* Survivor of the sweep */
+         assert(TBTermCellIsMarked(bank, term));
+         TermCellFlipProp(term, TPGarbageFlag);
+         if(TBGCYoungSweepDone(bank))
+         {
+            continue;
+         }
+      }
+      PStackAssignP(bank->gc_young, j, term);
+      j++;
+   }
+   PStackSetSP(bank->gc_young, j);
+   if(TBGCYoungSweepDone(bank))
+   {
+      bank->gc_young_start = bank->gc_mark_limit;
+   }
+
+   while(!PStackEmpty(bank->gc_rw_roots))
+   {
+      PStackPushP(bank->gc_remembered, PStackPopP(bank->gc_rw_roots));
+   }
+   for(i=0, j=0; i<PStackGetSP(bank->gc_remembered); i++)
+   {
+      term = PStackElementP(bank->gc_remembered, i);
+      if(TermIsRewritten(term) &&
+         TBTermCellIsYoung(bank, TermRWReplaceField(term)))
+      {
+         PStackAssignP(bank->gc_remembered, j, term);
+         j++;
+      }
+   }
+   PStackSetSP(bank->gc_remembered, j);
+
+   bank->gc_mark_limit = LONG_MAX;
+   bank->gc_sweep_pos  = 0;
+   bank->gc_sweep_keep = 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCNoteRWLinkReal()
+//
+//   Record that term has received a new rewrite link (see
+//   TBGCNoteRWLink()). The target has to survive a running young
+//   collection, and so does term (which is being rewritten, so it is
+//   not garbage yet).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, marks terms
+//
+/----------------------------------------------------------------------*/
+
+void TBGCNoteRWLinkReal(TB_p bank, Term_p term)
+{
+   assert(bank->gc_young);
+   assert(TermIsRewritten(term));
+
+   if(TBGCYoungRunning(bank))
+   {
+      TBGCMarkYoungTerm(bank, term);
+      TBGCMarkYoungTerm(bank, TermRWReplaceField(term));
+   }
+   PStackPushP(bank->gc_remembered, term);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TBCreateConstTerm()
@@ -12,9 +12,9 @@
 
   There are two sets of funktions for the manangment of term trees:
   Funktions operating only on the top cell, and functions descending
-  the term structure. Top level functions implement a conventional splay
-  tree with key f_code.masked_properties.entry_nos_of_args and are
-  implemented in cte_termtrees.[ch]
+  the term structure. Top level functions implement a hash table
+  with key f_code.addresses_of_args and are implemented in
+  cte_termcellstore.[ch]
 
   Copyright 1998-2017 by the author.
   This code is released under the GNU General Public Licence and
@@ -69,6 +69,26 @@ typedef struct tbcell
                                     get the new value, so that marking
                                     can be done by flipping in the
                                     term cell. */
+   long          gc_young_start; /* Cells with a larger entry_no have
+                                    been created since the last
+                                    collection (the young generation) */
+   long          gc_mark_limit;  /* While a young collection is in
+                                    progress, cells with a larger
+                                    entry_no have been created during
+                                    it and survive it. LONG_MAX
+                                    otherwise. */
+   PStack_p      gc_young;       /* Young cells in order of creation,
+                                    NULL unless generational
+                                    collection is active */
+   PStackPointer gc_sweep_pos;   /* Young cells below this have not
+                                    been swept yet */
+   PStackPointer gc_sweep_keep;  /* Survivors of the sweep are kept
+                                    from here on */
+   PStack_p      gc_remembered;  /* Cells that received a rewrite
+                                    link since the last collection */
+   PStack_p      gc_rw_roots;    /* Cells remembered before the
+                                    running collection, rewrite
+                                    targets still to be marked */
    struct gc_admin_cell *gc;     /* Higher level code can register
                                   * garbage collection information
                                   * here. This is only a convenience
@@ -114,7 +134,8 @@ long    TBTermNodes(TB_p bank);
 #define TBNonVarTermNodes(bank) TermCellStoreNodes(&(bank)->term_store)
 #define TBStorage(bank)                                 \
    (TERMCELL_DYN_MEM*(bank)->term_store.entries         \
-    +(bank)->term_store.arg_count*TERMP_MEM)
+    +(bank)->term_store.arg_count*TERMP_MEM             \
+    +TermCellStoreStorage(&(bank)->term_store))
 
 #define TBCellIdent(term) (TermIsVar(term)?(term)->f_code:term->entry_no)
 
@@ -123,9 +144,9 @@ long    TBTermNodes(TB_p bank);
 #define TBTermIsSubterm(super, term) TermIsSubterm((super),(term),DEREF_NEVER)
 
 #define TBTermIsTypeTerm(term)                                  \
-   ((term)->weight==(DEFAULT_VWEIGHT+DEFAULT_FWEIGHT))
+   (TermCellWeight(term)==(DEFAULT_VWEIGHT+DEFAULT_FWEIGHT))
 #define TBTermIsXTypeTerm(term)                                         \
-   (term->arity && ((term)->weight==(DEFAULT_FWEIGHT+(term)->arity*DEFAULT_VWEIGHT)))
+   (term->arity && (TermCellWeight(term)==(DEFAULT_FWEIGHT+(term)->arity*DEFAULT_VWEIGHT)))
 #define TBTermIsGround(t) TermCellQueryProp((t), TPIsGround)
 
 Term_p  TBInsert(TB_p bank, Term_p term, DerefType deref);
@@ -167,8 +188,33 @@ long    TBTermDelPropCount(Term_p term, TermProperties prop);
 
 #define TBTermCellIsMarked(bank, term)                                  \
    (GiveProps((term),TPGarbageFlag)!=(bank)->garbage_state)
+#define TBTermCellIsYoung(bank, term)                                   \
+   ((term)->entry_no > (bank)->gc_young_start)
+#define TBTermCellIsCollectable(bank, term)                             \
+   (TBTermCellIsYoung((bank),(term)) &&                                 \
+    (term)->entry_no <= (bank)->gc_mark_limit)
+#define TBGCYoungRunning(bank) ((bank)->gc_mark_limit != LONG_MAX)
+#define TBGCYoungSize(bank)                                             \
+   ((bank)->gc_young?PStackGetSP((bank)->gc_young):0)
+
 void    TBGCMarkTerm(TB_p bank, Term_p term);
 long    TBGCSweep(TB_p bank);
+void    TBGCStartGenerations(TB_p bank);
+void    TBGCMarkYoungTerm(TB_p bank, Term_p term);
+void    TBGCYoungStart(TB_p bank);
+long    TBGCYoungMarkRWStep(TB_p bank, long budget);
+long    TBGCYoungSweepStep(TB_p bank, long budget);
+bool    TBGCYoungSweepDone(TB_p bank);
+void    TBGCYoungStop(TB_p bank);
+void    TBGCNoteRWLinkReal(TB_p bank, Term_p term);
+
+/* Shared cells only point to older cells, except via rewrite
+   links. Those are remembered for the next young generation
+   collection, links created while one is running are also marked
+   right away. */
+#define TBGCNoteRWLink(bank, term)                                      \
+   do{if(UNLIKELY((bank)->gc_young))                                    \
+      {TBGCNoteRWLinkReal((bank), (term));}}while(0)
 Term_p  TBCreateConstTerm(TB_p bank, FunCode const);
 Term_p  TBCreateMinTerm(TB_p bank, FunCode min_const);
 
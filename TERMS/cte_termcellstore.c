@@ -6,8 +6,8 @@ Author: Stephan Schulz
 
 Contents
 
-  Implementation of term cell stores (except for all intersting parts,
-  which are realized as macros...
+  Implementation of term cell stores as hash tables with chaining
+  through the term cells.
 
   Copyright 1998, 1999 by the author.
   This code is released under the GNU General Public Licence and
@@ -19,6 +19,8 @@ Changes
 
 <1> Mon Oct  5 01:09:50 MEST 1998
     New
+<2> Mon Oct 19 04:21:16 CEST 2026
+    Chained hash table instead of hashed splay trees
 
 -----------------------------------------------------------------------*/
 
@@ -30,6 +32,9 @@ Changes
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* Fibonacci hashing multiplier */
+#define TCS_HASH_MULT 0x9E3779B97F4A7C15ULL
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -40,13 +45,70 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: tcs_hash()
+//
+//   Return the bucket of term in store. The hash value depends on the
+//   function symbol and the addresses of all arguments (which are
+//   shared).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ long tcs_hash(TermCellStore_p store, Term_p term)
+{
+   uint64_t hash = (uint64_t)term->f_code;
+
+   for(int i=0; i<term->arity; i++)
+   {
+      hash = (hash*TCS_HASH_MULT)^((uintptr_t)term->args[i]>>3);
+   }
+   return (long)((hash*TCS_HASH_MULT)>>(64-store->bits));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tcs_term_top_equal()
+//
+//   Return true if the two term cells have the same symbol and the
+//   same (shared) arguments.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ bool tcs_term_top_equal(Term_p t1, Term_p t2)
+{
+   if(t1->f_code != t2->f_code || t1->arity != t2->arity)
+   {
+      return false;
+   }
+   assert(problemType == PROBLEM_HO || t1->type == t2->type);
+   for(int i=0; i<t1->arity; i++)
+   {
+      if(t1->args[i] != t2->args[i])
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
 
 /*-----------------------------------------------------------------------
 //
-// Function: collect_unmarked_termcells()
+// Function: tcs_find_ref()
 //
-//   Push the addresses of all unmarked term cells in the tree onto
-//   the stack.
+//   Return a pointer to the link that points to the cell equal to
+//   term (or to the NULL link at the end of the chain if there is
+//   none).
 //
 // Global Variables: -
 //
@@ -54,29 +116,56 @@ Changes
 //
 /----------------------------------------------------------------------*/
 
-static void collect_unmarked_termcells(PStack_p res_stack, Term_p tree,
-                   TermProperties gc_state)
+static __inline__ Term_p* tcs_find_ref(TermCellStore_p store, Term_p term)
 {
-   PStack_p stack = PStackAlloc();
+   Term_p *ref = &(store->store[tcs_hash(store, term)]);
+
+   while(*ref && !tcs_term_top_equal(*ref, term))
+   {
+      ref = &((*ref)->chain);
+   }
+   return ref;
+}
 
-   PStackPushP(stack, tree);
 
-   while(!PStackEmpty(stack))
+/*-----------------------------------------------------------------------
+//
+// Function: tcs_resize()
+//
+//   Rehash all cells into a table with 2^bits buckets.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes store
+//
+/----------------------------------------------------------------------*/
+
+static void tcs_resize(TermCellStore_p store, int bits)
+{
+   Term_p *old_store = store->store;
+   long   old_size = TermCellStoreSize(store), i, hash;
+   Term_p cell, next;
+
+   store->bits  = bits;
+   store->store = SizeMalloc(TermCellStoreSize(store)*sizeof(Term_p));
+   for(i=0; i<TermCellStoreSize(store); i++)
+   {
+      store->store[i] = NULL;
+   }
+   for(i=0; i<old_size; i++)
    {
-      tree = PStackPopP(stack);
-      if(tree)
+      for(cell = old_store[i]; cell; cell = next)
       {
-    if(GiveProps(tree,TPGarbageFlag)==gc_state)
-    {
-       PStackPushP(res_stack, tree);
-    }
-    PStackPushP(stack, tree->lson);
-    PStackPushP(stack, tree->rson);
+         next = cell->chain;
+         hash = tcs_hash(store, cell);
+         cell->chain = store->store[hash];
+         store->store[hash] = cell;
       }
    }
-   PStackFree(stack);
+   SizeFree(old_store, old_size*sizeof(Term_p));
 }
 
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -89,17 +178,19 @@ static void collect_unmarked_termcells(PStack_p res_stack, Term_p tree,
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
 void TermCellStoreInit(TermCellStore_p store)
 {
-   int i;
+   long i;
 
    store->entries = 0;
    store->arg_count = 0;
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   store->bits = TERM_STORE_INIT_BITS;
+   store->store = SizeMalloc(TermCellStoreSize(store)*sizeof(Term_p));
+   for(i=0; i<TermCellStoreSize(store); i++)
    {
       store->store[i] = NULL;
    }
@@ -109,7 +200,8 @@ void TermCellStoreInit(TermCellStore_p store)
 //
 // Function: TermCellStoreExit()
 //
-//   Free the trees in a term cell storage.
+//   Free the cells in a term cell storage and the table itself. Do
+//   not free variables, as they belong to a variable bank as well.
 //
 // Global Variables: -
 //
@@ -119,13 +211,24 @@ void TermCellStoreInit(TermCellStore_p store)
 
 void TermCellStoreExit(TermCellStore_p store)
 {
-   int i;
+   long i;
+   Term_p cell, next;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(store); i++)
    {
-      TermTreeFree(store->store[i]);
-      store->store[i] = NULL;
+      for(cell = store->store[i]; cell; cell = next)
+      {
+         next = cell->chain;
+         if(!TermIsVar(cell))
+         {
+            TermTopFree(cell);
+         }
+      }
    }
+   SizeFree(store->store, TermCellStoreSize(store)*sizeof(Term_p));
+   store->store = NULL;
+   store->entries = 0;
+   store->arg_count = 0;
 }
 
 
@@ -143,8 +246,7 @@ void TermCellStoreExit(TermCellStore_p store)
 
 Term_p  TermCellStoreFind(TermCellStore_p store, Term_p term)
 {
-   return TermTreeFind(&(store->store[TermCellHash(term)]), term);
-
+   return *tcs_find_ref(store, term);
 }
 
 
@@ -152,7 +254,9 @@ Term_p  TermCellStoreFind(TermCellStore_p store, Term_p term)
 //
 // Function: TermCellStoreInsert()
 //
-//   Insert a term cell into the store.
+//   Insert a term cell into the store. If an equal cell already
+//   exists, return it (and leave the store unchanged), otherwise
+//   return NULL.
 //
 // Global Variables: -
 //
@@ -164,15 +268,46 @@ Term_p  TermCellStoreInsert(TermCellStore_p store, Term_p term)
 {
    Term_p ret;
 
-   ret = TermTreeInsert(&(store->store[TermCellHash(term)]), term);
+   ret = TermCellStoreFind(store, term);
    if(!ret)
    {
-      store->entries++;
-      store->arg_count+=term->arity;
+      TermCellStoreAdd(store, term);
    }
    return ret;
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermCellStoreAdd()
+//
+//   Add a term cell that is known not to be in the store yet. The
+//   table is doubled when there are more entries than buckets.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes store.
+//
+/----------------------------------------------------------------------*/
+
+void TermCellStoreAdd(TermCellStore_p store, Term_p term)
+{
+   long hash;
+
+   assert(!TermCellStoreFind(store, term));
+
+   if(store->entries >= TermCellStoreSize(store))
+   {
+      tcs_resize(store, store->bits+1);
+   }
+   hash = tcs_hash(store, term);
+   term->chain = store->store[hash];
+   store->store[hash] = term;
+   store->entries++;
+   store->arg_count+=term->arity;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TermCellStoreExtract()
@@ -187,12 +322,15 @@ Term_p  TermCellStoreInsert(TermCellStore_p store, Term_p term)
 
 Term_p  TermCellStoreExtract(TermCellStore_p store, Term_p term)
 {
-   Term_p ret;
-   ret = TermTreeExtract(&(store->store[TermCellHash(term)]), term);
+   Term_p *ref = tcs_find_ref(store, term);
+   Term_p ret = *ref;
+
    if(ret)
    {
+      *ref = ret->chain;
+      ret->chain = NULL;
       store->entries--;
-      store->arg_count-=term->arity;
+      store->arg_count-=ret->arity;
    }
    assert(store->entries>=0);
    return ret;
@@ -213,17 +351,15 @@ Term_p  TermCellStoreExtract(TermCellStore_p store, Term_p term)
 
 bool TermCellStoreDelete(TermCellStore_p store, Term_p term)
 {
-   bool ret;
-
-   ret = TermTreeDelete(&(store->store[TermCellHash(term)]), term);
+   Term_p cell;
 
-   if(ret)
+   cell = TermCellStoreExtract(store, term);
+   if(cell)
    {
-      store->entries--;
-      store->arg_count-=term->arity;
+      TermTopFree(cell);
+      return true;
    }
-   assert(store->entries>=0);
-   return ret;
+   return false;
 }
 
 
@@ -241,11 +377,15 @@ bool TermCellStoreDelete(TermCellStore_p store, Term_p term)
 
 void TermCellStoreSetProp(TermCellStore_p store, TermProperties props)
 {
-   int i;
+   long i;
+   Term_p cell;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(store); i++)
    {
-      TermTreeSetProp(store->store[i], props);
+      for(cell = store->store[i]; cell; cell = cell->chain)
+      {
+         TermCellSetProp(cell, props);
+      }
    }
 }
 
@@ -263,11 +403,15 @@ void TermCellStoreSetProp(TermCellStore_p store, TermProperties props)
 
 void TermCellStoreDelProp(TermCellStore_p store, TermProperties props)
 {
-   int i;
+   long i;
+   Term_p cell;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(store); i++)
    {
-      TermTreeDelProp(store->store[i], props);
+      for(cell = store->store[i]; cell; cell = cell->chain)
+      {
+         TermCellDelProp(cell, props);
+      }
    }
 }
 
@@ -286,12 +430,15 @@ void TermCellStoreDelProp(TermCellStore_p store, TermProperties props)
 
 long TermCellStoreCountNodes(TermCellStore_p store)
 {
-   long res = 0;
-   int i;
+   long res = 0, i;
+   Term_p cell;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(store); i++)
    {
-      res+=TermTreeNodes(store->store[i]);
+      for(cell = store->store[i]; cell; cell = cell->chain)
+      {
+         res++;
+      }
    }
    return res;
 }
@@ -302,10 +449,7 @@ long TermCellStoreCountNodes(TermCellStore_p store)
 // Function: TermCellStoreGCSweep()
 //
 //   Sweep the term cell store and free unmarked cells. Return number
-//   of cells recovered. Note that we separate the collection of
-//   unmarked terms from the actual deletion, since walking the trees
-//   while they may be reorganized is somewhere between messy and
-//   impossible.
+//   of cells recovered.
 //
 // Global Variables: -
 //
@@ -315,22 +459,29 @@ long TermCellStoreCountNodes(TermCellStore_p store)
 
 long TermCellStoreGCSweep(TermCellStore_p store, TermProperties gc_state)
 {
-   long recovered = 0;
-   int i;
-   PStack_p del_stack = PStackAlloc();
-   Term_p cell;
+   long recovered = 0, i;
+   Term_p *ref, cell;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(store); i++)
    {
-      collect_unmarked_termcells(del_stack, store->store[i], gc_state);
-      while(!PStackEmpty(del_stack))
+      ref = &(store->store[i]);
+      while((cell = *ref))
       {
-    cell = PStackPopP(del_stack);
-    TermCellStoreDelete(store, cell);
-    recovered++;
+         if(GiveProps(cell,TPGarbageFlag)==gc_state)
+         {
+            *ref = cell->chain;
+            store->entries--;
+            store->arg_count-=cell->arity;
+            TermTopFree(cell);
+            recovered++;
+         }
+         else
+         {
+            ref = &(cell->chain);
+         }
       }
    }
-   PStackFree(del_stack);
+   assert(store->entries>=0);
    return recovered;
 }
 
@@ -339,8 +490,8 @@ long TermCellStoreGCSweep(TermCellStore_p store, TermProperties gc_state)
 //
 // Function: TermCellStorePrintDistrib()
 //
-//   For each entry (hash value) in store, print the number of term
-//   cells in the corresponding tree.
+//   For each bucket in store, print the number of term cells in the
+//   corresponding chain.
 //
 // Global Variables: -
 //
@@ -350,17 +501,20 @@ long TermCellStoreGCSweep(TermCellStore_p store, TermProperties gc_state)
 
 void TermCellStorePrintDistrib(FILE* out, TermCellStore_p store)
 {
-   int i;
+   long i, count;
+   Term_p cell;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(store); i++)
    {
-      fprintf(out, "# Hash %4d: %6ld\n", i, TermTreeNodes(store->store[i]));
+      count = 0;
+      for(cell = store->store[i]; cell; cell = cell->chain)
+      {
+         count++;
+      }
+      fprintf(out, "# Hash %4ld: %6ld\n", i, count);
    }
 }
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
-
-
-
@@ -6,11 +6,10 @@ Author: Stephan Schulz
 
 Contents
 
-  Abstract interface for storing term cells, implemented by a
-  combination of a hashed array and term cell trees. Use
-  (term->f_code^term->args[1])&TERM_STORE_HASH_MASK  as
-  hash if args != NULL, otherwise use
-  term->f_code&TERM_STORE_HASH_MASK.
+  Abstract interface for storing term cells, implemented as a hash
+  table with chaining through the term cells. The table grows with
+  the number of entries. The hash combines the function symbol and
+  all argument pointers.
 
   Copyright 1998, 1999 by the author.
   This code is released under the GNU General Public Licence and
@@ -25,6 +24,9 @@ Changes
 <2> Thu Apr 11 10:08:26 CEST 2002
     Support for mark-and-sweep garbage collection (the sweep pass) for
     term cells
+<3> Mon Oct 19 04:21:16 CEST 2026
+    Replaced the fixed array of splay trees by a growing chained hash
+    table (saves two pointers per term cell)
 
 -----------------------------------------------------------------------*/
 
@@ -32,20 +34,20 @@ Changes
 
 #define CTE_TERMCELLSTORE
 
-#include <cte_termtrees.h>
+#include <cte_termfunc.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
-#define TERM_STORE_HASH_SIZE (8192*4)
-#define TERM_STORE_HASH_MASK (TERM_STORE_HASH_SIZE-1)
+#define TERM_STORE_INIT_BITS 12  /* Initial size is 2^this */
 
 typedef struct termcellstore
 {
    long   entries;
    long   arg_count;
-   Term_p store[TERM_STORE_HASH_SIZE];
+   int    bits;      /* Number of buckets is 2^bits */
+   Term_p *store;    /* Buckets, chained via term->chain */
 }TermCellStoreCell, *TermCellStore_p;
 
 
@@ -53,21 +55,17 @@ typedef struct termcellstore
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
-#define tcs_arity0hash(term) ((term)->f_code)
-#define tcs_arity1hash(term) (tcs_arity0hash(term)^(((intptr_t)(term)->args[0])>>3))
-#define tcs_aritynhash(term) (tcs_arity1hash(term)^(((intptr_t)(term)->args[1])>>4))
-
-#define TermCellHash(term)\
-((((term)->arity == 0)?\
-  tcs_arity0hash(term):\
-  (((term)->arity == 1)?tcs_arity1hash(term):tcs_aritynhash(term)))\
-   &TERM_STORE_HASH_MASK)
+#define TermCellStoreSize(tcs)       (1L<<(tcs)->bits)
+#define TermCellStoreBucket(tcs, i)  ((tcs)->store[(i)])
+#define TermCellStoreStorage(tcs)    \
+   (TermCellStoreSize(tcs)*(long)sizeof(Term_p))
 
 void    TermCellStoreInit(TermCellStore_p store);
 void    TermCellStoreExit(TermCellStore_p store);
 
 Term_p  TermCellStoreFind(TermCellStore_p store, Term_p term);
 Term_p  TermCellStoreInsert(TermCellStore_p store, Term_p term);
+void    TermCellStoreAdd(TermCellStore_p store, Term_p term);
 Term_p  TermCellStoreExtract(TermCellStore_p store, Term_p term);
 bool    TermCellStoreDelete(TermCellStore_p store, Term_p term);
 
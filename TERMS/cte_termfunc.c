@@ -1211,19 +1211,31 @@ long TermWeightCompute(Term_p term, long vweight, long fweight)
 // Function: TermFsumWeight()
 //
 //   Return a weighted sum of the function symbols weights (and
-//   variable weights) in the term.
+//   variable weights) in the term. If memo is not NULL, it has to
+//   belong to this combination of weights, and is used for large
+//   shared subterms.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations
+// Side Effects    : Memory operations, changes memo
 //
 /----------------------------------------------------------------------*/
 
 long TermFsumWeight(Term_p term, long vweight, long flimit,
                     long *fweights, long default_fweight,
-                    long* typefreqs)
+                    long* typefreqs, TermWeightMemo_p memo)
 {
-   long res = 0;
+   long   res = 0;
+   double *memo_res;
+   bool   memoize = TermWeightMemoApplies(memo, term);
+
+   if(memoize && (memo_res = TermWeightMemoFind(memo, term)))
+   {
+      assert((long)*memo_res == TermFsumWeight(term, vweight, flimit, fweights,
+                                               default_fweight, typefreqs,
+                                               NULL));
+      return (long)*memo_res;
+   }
 
    if(TermIsVar(term))
    {
@@ -1263,12 +1275,14 @@ long TermFsumWeight(Term_p term, long vweight, long flimit,
       for(int i = 0; i < term->arity; i++)
       {
          res += TermFsumWeight(term->args[i], vweight, flimit, fweights, default_fweight,
-                               typefreqs);
+                               typefreqs, memo);
       }
    }
-
+   if(memoize)
+   {
+      *TermWeightMemoStore(memo, term) = res;
+   }
    return res;
-
 }
 
 
@@ -1569,6 +1583,37 @@ bool TermIsGroundCompute(Term_p term)
    return res;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: TermVarMaskCompute()
+//
+//   Return the variable occurence mask of term (see VarMaskBit()).
+//   Does not follow bindings.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+VarMask TermVarMaskCompute(Term_p term)
+{
+   VarMask res = 0;
+
+   if(TermIsVar(term))
+   {
+      res = VarMaskBit(term->f_code);
+   }
+   else
+   {
+      for(int i=0; i < term->arity; i++)
+      {
+         res |= TermVarMask(term->args[i]);
+      }
+   }
+   return res;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: TermFindMaxVarCode()
@@ -25,6 +25,7 @@
 
 #include <clb_numtrees.h>
 #include <cte_termvars.h>
+#include <cte_termweightmemo.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -95,11 +96,12 @@ long    TermWeightCompute(Term_p term, long vweight, long fweight);
 #define TermDefaultWeight(term) TermWeightCompute((term), DEFAULT_VWEIGHT, DEFAULT_FWEIGHT)
 #define TermStandardWeight(term) \
         (TermIsShared(term)? \
-         (assert((term)->weight == TermDefaultWeight((term))),(term)->weight) : \
+         (assert(TermCellWeight(term) == TermDefaultWeight((term))),TermCellWeight(term)) : \
          TermDefaultWeight((term)))
 
 long    TermFsumWeight(Term_p term, long vweight, long flimit,
-                       long *fweights, long default_fweight, long* typefreqs);
+                       long *fweights, long default_fweight, long* typefreqs,
+                       TermWeightMemo_p memo);
 
 long    TermNonLinearWeight(Term_p term, long vlweight, long vweight, long fweight);
 long    TermSymTypeWeight(Term_p term, long vweight, long fweight, long cweight, long pweight);
@@ -120,6 +122,13 @@ bool    TermIsGroundCompute(Term_p term);
          TBTermIsGround((term)): \
          TermIsGroundCompute((term)))
 
+VarMask TermVarMaskCompute(Term_p term);
+#define TermVarMask(term) \
+        (TermIsShared(term)? \
+         (assert((term)->var_mask == TermVarMaskCompute(term)), \
+          (term)->var_mask): \
+         TermVarMaskCompute((term)))
+
 FunCode TermFindMaxVarCode(Term_p term);
 
 long    VarBankCheckBindings(FILE* out, VarBank_p bank, Sig_p sig);
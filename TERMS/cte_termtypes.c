@@ -214,6 +214,11 @@ void TermTopFree(Term_p junk)
    if(junk->arity)
    {
       assert(junk->args);
+      if(TermHasInlineArgs(junk))
+      {
+         TermInlineCellFree(junk, junk->arity);
+         return;
+      }
       TermArgArrayFree(junk->args, junk->arity);
    }
    else
@@ -223,6 +228,43 @@ void TermTopFree(Term_p junk)
    TermCellFree(junk);
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermTopInlineArgs()
+//
+//   Return a copy of the term cell that stores its argument array
+//   inline (in the same memory block) and free the original. This
+//   saves a separate allocation per shared term and keeps the
+//   arguments next to the cell. Cells with inline arguments must not
+//   change their arity.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+Term_p TermTopInlineArgs(Term_p term)
+{
+   Term_p handle;
+
+   if(!term->arity || TermHasInlineArgs(term))
+   {
+      return term;
+   }
+   handle = TermInlineCellAlloc(term->arity);
+   *handle = *term;
+   handle->args = (Term_p*)(handle+1);
+   for(int i=0; i<term->arity; i++)
+   {
+      handle->args[i] = term->args[i];
+   }
+   TermTopFree(term);
+
+   return handle;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function:  TermFree()
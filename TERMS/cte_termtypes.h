@@ -97,7 +97,11 @@ typedef enum  /* See CLAUSES/ccl_rewrite.c for more */
    FullRewrite = 2    /* Rewrite with rules and equations */
 }RewriteLevel;
 
-typedef struct
+/* A rewritten term is never again checked for normal form, so the
+   normal form dates and the rewrite link can share storage. Which
+   one is valid is determined by TPIsRewritten. */
+
+typedef union
 {
    SysDate          nf_date[FullRewrite]; /* If term is not rewritten,
                                              it is in normal form with
@@ -111,6 +115,21 @@ typedef struct
    }rw_desc;
 }RewriteState;
 
+/* Variable occurrence masks: Variables with f_codes -1 to
+   -(VAR_MASK_BITS-1) own one bit each, all others share the overflow
+   bit. A mask without the overflow bit describes the variables of a
+   term exactly, otherwise only the small ones are known. */
+
+typedef uint64_t VarMask;
+
+#define VAR_MASK_BITS     64
+#define VAR_MASK_OVERFLOW (((VarMask)1)<<(VAR_MASK_BITS-1))
+
+#define VarMaskBit(f_code) \
+        ((-(f_code)) < VAR_MASK_BITS ? \
+         ((VarMask)1)<<(-(f_code)-1) : VAR_MASK_OVERFLOW)
+#define VarMaskIsExact(mask) (!((mask) & VAR_MASK_OVERFLOW))
+
 struct tbcell;
 
 typedef struct termcell
@@ -120,7 +139,9 @@ typedef struct termcell
    int              arity;         /* Redundant, but saves handing
                                       around the signature all the
                                       time */
-   struct termcell* *args;         /* Pointer to array of arguments */
+   struct termcell* *args;         /* Pointer to array of arguments
+                                      (stored inline for shared
+                                      terms) */
    struct termcell* binding;       /* For variable bindings,
                                       potentially for temporary
                                       rewrites - it might be possible
@@ -130,13 +151,19 @@ typedef struct termcell
                                       termbank - needed for
                                       administration and external
                                       representation */
-   long             weight;        /* Weight of the term, if term is in term bank */
    unsigned int     v_count;       /* Number of variables, if term is in term bank */
-   unsigned int     f_count;       /* Number of function symbols, if term is in term bank */
+   unsigned int     f_count;       /* Number of function symbols, if
+                                      term is in term bank. Together
+                                      with v_count this also
+                                      determines the standard weight,
+                                      see TermCellWeight() */
+   VarMask          var_mask;      /* Variables occuring in the term,
+                                      if term is in term bank - see
+                                      VarMaskBit() */
    RewriteState     rw_data;       /* See above */
    Type_p           type;          /* Sort of the term */
-   struct termcell* lson;          /* For storing shared term nodes in */
-   struct termcell* rson;          /* a splay tree - see
+   struct termcell* chain;         /* Next term in the same bucket of
+                                      the term cell store - see
                                       cte_termcellstore.[ch] */
 
 #ifdef ENABLE_LFHO
@@ -238,10 +265,27 @@ typedef uintptr_t DerefType, *DerefType_p;
 #define TermCellGiveProps(term, props) GiveProps((term),(props))
 #define TermCellFlipProp(term, props) FlipProp((term),(props))
 
-#define TermCellAlloc() (TermCell*)SizeMalloc(sizeof(TermCell))
-#define TermCellFree(junk)         SizeFree(junk, sizeof(TermCell))
-#define TermArgArrayAlloc(arity) ((Term_p*)SizeMalloc((arity)*sizeof(Term_p)))
-#define TermArgArrayFree(junk, arity) SizeFree((junk),(arity)*sizeof(Term_p))
+#define TermCellAlloc() (TermCell*)SizeMallocClass(sizeof(TermCell), MemClassTerm)
+#define TermCellFree(junk)         SizeFreeClass(junk, sizeof(TermCell), MemClassTerm)
+#define TermArgArrayAlloc(arity) ((Term_p*)SizeMallocClass((arity)*sizeof(Term_p), \
+                                                          MemClassTerm))
+#define TermArgArrayFree(junk, arity) SizeFreeClass((junk),(arity)*sizeof(Term_p), \
+                                                    MemClassTerm)
+
+/* Term cells with the argument array in the same block. Only shared
+   terms have them - a separately allocated array may happen to be
+   adjacent to its cell (e.g. with huge page backed memory). */
+#define TermInlineCellSize(arity) (sizeof(TermCell)+(arity)*sizeof(Term_p))
+#define TermInlineCellAlloc(arity) \
+   (TermCell*)SizeMallocClass(TermInlineCellSize(arity), MemClassTerm)
+#define TermInlineCellFree(junk, arity) \
+   SizeFreeClass(junk, TermInlineCellSize(arity), MemClassTerm)
+#define TermHasInlineArgs(term) (TermCellQueryProp((term), TPIsShared) && \
+                                 (term)->args == (Term_p*)((term)+1))
+
+/* Standard weight of a shared term or a variable */
+#define TermCellWeight(term) ((long)(term)->v_count*DEFAULT_VWEIGHT+\
+                              (long)(term)->f_count*DEFAULT_FWEIGHT)
 
 #define TermIsRewritten(term) TermCellQueryProp((term), TPIsRewritten)
 #define TermIsRRewritten(term) TermCellQueryProp((term), TPIsRRewritten)
@@ -273,6 +317,7 @@ static __inline__ Term_p TermTopCopy(Term_p source);
 static __inline__ Term_p TermTopCopyWithoutArgs(Term_p source);
 
 void    TermTopFree(Term_p junk);
+Term_p  TermTopInlineArgs(Term_p term);
 void    TermFree(Term_p junk);
 Term_p  TermAllocNewSkolem(Sig_p sig, PStack_p variables, Type_p type);
 
@@ -561,10 +606,10 @@ static __inline__ Term_p TermDefaultCellAlloc(void)
    handle->type       = NULL;
    handle->binding    = NULL;
    handle->args       = NULL;
+   handle->var_mask   = 0;
    handle->rw_data.nf_date[0] = SysDateCreationTime();
    handle->rw_data.nf_date[1] = SysDateCreationTime();
-   handle->lson = NULL;
-   handle->rson = NULL;
+   handle->chain = NULL;
    TermSetCache(handle, NULL);
    TermSetBank(handle, NULL);
 
@@ -484,9 +484,9 @@ Term_p var_bank_var_alloc(VarBank_p bank, FunCode f_code, Type_p type)
    var = TermDefaultCellAlloc();
    TermCellSetProp(var, TPIsShared);
 
-   var->weight = DEFAULT_VWEIGHT;
    var->v_count = 1;
    var->f_count = 0;
+   var->var_mask = VarMaskBit(f_code);
    var->entry_no = f_code;
    var->f_code = f_code;
    var->type = type;
@@ -34,6 +34,37 @@
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: twe_term_weight()
+//
+//   Apply the term weight function to term, using the memo for large
+//   shared terms (if there is one).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes twe->memo
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ double twe_term_weight(Term_p term, TermWeightExtension_p twe)
+{
+   double *memo_res, res;
+
+   if(!TermWeightMemoApplies(twe->memo, term))
+   {
+      return twe->term_weight_fun(term, twe->data);
+   }
+   if((memo_res = TermWeightMemoFind(twe->memo, term)))
+   {
+      return *memo_res;
+   }
+   res = twe->term_weight_fun(term, twe->data);
+   *TermWeightMemoStore(twe->memo, term) = res;
+
+   return res;
+}
+
 static double term_ext_weight_sum(Term_p term, TermWeightExtension_p twe)
 {
    int i;
@@ -48,7 +79,7 @@ static double term_ext_weight_sum(Term_p term, TermWeightExtension_p twe)
    while (!PStackEmpty(stack))
    {
       subterm = PStackPopP(stack);
-      res += twe->term_weight_fun(subterm, twe->data);
+      res += twe_term_weight(subterm, twe);
 
       if (!TermIsVar(subterm))
       {
@@ -77,7 +108,7 @@ static double term_ext_weight_max(Term_p term, TermWeightExtension_p twe)
    while (!PStackEmpty(stack))
    {
       subterm = PStackPopP(stack);
-      res = MAX(res, twe->term_weight_fun(subterm, twe->data));
+      res = MAX(res, twe_term_weight(subterm, twe));
 
       if (!TermIsVar(subterm))
       {
@@ -100,7 +131,9 @@ static double term_ext_weight_max(Term_p term, TermWeightExtension_p twe)
 //
 // Function: TermWeightExtensionAlloc()
 //
-//   Allocate and initialize a new extension cell.
+//   Allocate and initialize a new extension cell. If memoize is
+//   true, term_weight_fun has to return a fixed value for each term,
+//   and results for shared terms are memoized.
 //
 // Global Variables: -
 //
@@ -114,7 +147,8 @@ TermWeightExtension_p TermWeightExtensionAlloc(
    double pos_eq_multiplier,
    TermWeightExtenstionStyle ext_style,
    TermWeightFun term_weight_fun,
-   void* data)
+   void* data,
+   bool memoize)
 {
    TermWeightExtension_p handle = TermWeightExtensionCellAlloc();
 
@@ -124,6 +158,7 @@ TermWeightExtension_p TermWeightExtensionAlloc(
    handle->ext_style = ext_style;
    handle->term_weight_fun = term_weight_fun;
    handle->data = data;
+   handle->memo = memoize? TermWeightMemoAlloc(TERM_WEIGHT_MEMO_BITS, 1) : NULL;
 
    return handle;
 }
@@ -142,6 +177,10 @@ TermWeightExtension_p TermWeightExtensionAlloc(
 
 void TermWeightExtensionFree(TermWeightExtension_p junk)
 {
+   if(junk->memo)
+   {
+      TermWeightMemoFree(junk->memo);
+   }
    TermWeightExtensionCellFree(junk);
 }
 
@@ -164,7 +203,7 @@ double TermExtWeight(Term_p term, TermWeightExtension_p twe)
 {
    switch (twe->ext_style) 
    {
-      case TWESimple: return twe->term_weight_fun(term, twe->data);
+      case TWESimple: return twe_term_weight(term, twe);
       case TWESubtermsSum: return term_ext_weight_sum(term, twe);
       case TWESubtermsMax: return term_ext_weight_max(term, twe);
       default: Error("TermExtWeight: Unsupported evaluation extension style %d", 
@@ -23,6 +23,7 @@
 #define CTE_TERMWEIGHTEXT
 
 #include "cte_termtypes.h"
+#include "cte_termweightmemo.h"
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -49,6 +50,9 @@ typedef struct termweightextensioncell
    TermWeightExtenstionStyle ext_style; /* extension style */
    TermWeightFun term_weight_fun;       /* term weight function */
    void* data;                          /* optional data param */
+   TermWeightMemo_p memo;               /* term_weight_fun values of
+                                           shared terms, if the function
+                                           only depends on the term */
 } TermWeightExtensionCell, *TermWeightExtension_p;
 
 /*---------------------------------------------------------------------*/
@@ -64,7 +68,8 @@ TermWeightExtension_p TermWeightExtensionAlloc(
    double pos_eq_multiplier,
    TermWeightExtenstionStyle ext_style,
    TermWeightFun term_weight_fun,
-   void* data);
+   void* data,
+   bool memoize);
 
 void TermWeightExtensionFree(TermWeightExtension_p junk);
 
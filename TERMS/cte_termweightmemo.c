@@ -0,0 +1,99 @@
+/*-----------------------------------------------------------------------
+
+File  : cte_termweightmemo.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Memoization of term weights for shared terms.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 07:23:52 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "cte_termweightmemo.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermWeightMemoAlloc()
+//
+//   Allocate an empty memo with 2^bits slots for values of width
+//   doubles.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+TermWeightMemo_p TermWeightMemoAlloc(int bits, int width)
+{
+   TermWeightMemo_p handle = TermWeightMemoCellAlloc();
+   long i;
+
+   handle->bits   = bits;
+   handle->width  = width;
+   handle->keys   = SizeMalloc(TermWeightMemoSize(handle)*sizeof(long));
+   handle->values = SizeMalloc(TermWeightMemoSize(handle)*width*sizeof(double));
+   for(i=0; i<TermWeightMemoSize(handle); i++)
+   {
+      handle->keys[i] = 0;
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermWeightMemoFree()
+//
+//   Free a memo.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void TermWeightMemoFree(TermWeightMemo_p junk)
+{
+   SizeFree(junk->keys, TermWeightMemoSize(junk)*sizeof(long));
+   SizeFree(junk->values, TermWeightMemoSize(junk)*junk->width*sizeof(double));
+   TermWeightMemoCellFree(junk);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,143 @@
+/*-----------------------------------------------------------------------
+
+File  : cte_termweightmemo.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Memoization of term weights for shared terms. A memo belongs to a
+  single weight function and caches its (fixed) value for a term
+  under the entry_no of the term cell. A value is a vector of a fixed
+  number (the width of the memo) of doubles. The memo is a
+  direct-mapped table of bounded size: A new entry replaces the one
+  it collides with. As entry_nos are never reused within a term bank,
+  an entry can never become stale. The memo is only used for terms
+  large enough to make a lookup cheaper than a recomputation.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 07:23:52 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CTE_TERMWEIGHTMEMO
+
+#define CTE_TERMWEIGHTMEMO
+
+#include <cte_termtypes.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define TERM_WEIGHT_MEMO_BITS      14 /* Default size is 2^this */
+#define TERM_WEIGHT_MEMO_MIN_SIZE  6  /* Smaller terms are not memoized */
+
+typedef struct term_weight_memo_cell
+{
+   int    bits;
+   int    width;    /* Number of doubles per value */
+   long   *keys;    /* entry_no of the term in each slot, 0 if none */
+   double *values;
+}TermWeightMemoCell, *TermWeightMemo_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define TERM_WEIGHT_MEMO_HASH_MULT 0x9E3779B97F4A7C15ULL
+
+#define TermWeightMemoCellAlloc() \
+   (TermWeightMemoCell*)SizeMalloc(sizeof(TermWeightMemoCell))
+#define TermWeightMemoCellFree(junk) \
+   SizeFree(junk, sizeof(TermWeightMemoCell))
+
+#define TermWeightMemoSize(memo) (1L<<(memo)->bits)
+#define TermWeightMemoSlot(memo, term) \
+   ((long)(((uint64_t)(term)->entry_no*TERM_WEIGHT_MEMO_HASH_MULT)>>\
+           (64-(memo)->bits)))
+
+/* Only shared terms have a unique entry_no and valid symbol counts */
+#define TermWeightMemoApplies(memo, term) \
+   ((memo) && TermIsShared(term) && \
+    (term)->f_count+(term)->v_count >= TERM_WEIGHT_MEMO_MIN_SIZE)
+
+TermWeightMemo_p TermWeightMemoAlloc(int bits, int width);
+void             TermWeightMemoFree(TermWeightMemo_p junk);
+
+static __inline__ double* TermWeightMemoFind(TermWeightMemo_p memo,
+                                             Term_p term);
+static __inline__ double* TermWeightMemoStore(TermWeightMemo_p memo,
+                                              Term_p term);
+
+
+/*---------------------------------------------------------------------*/
+/*                  Implementations as inline functions                */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermWeightMemoFind()
+//
+//   Return the value recorded for term in memo, or NULL if there is
+//   none.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ double* TermWeightMemoFind(TermWeightMemo_p memo,
+                                             Term_p term)
+{
+   long slot = TermWeightMemoSlot(memo, term);
+
+   assert(TermIsShared(term));
+   if(memo->keys[slot] == term->entry_no)
+   {
+      return &(memo->values[slot*memo->width]);
+   }
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermWeightMemoStore()
+//
+//   Make memo record a value for term (replacing the entry in the
+//   same slot) and return the place the value has to be written to.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes memo
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ double* TermWeightMemoStore(TermWeightMemo_p memo,
+                                              Term_p term)
+{
+   long slot = TermWeightMemoSlot(memo, term);
+
+   assert(TermIsShared(term));
+   memo->keys[slot] = term->entry_no;
+   return &(memo->values[slot*memo->width]);
+}
+
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+# ----------------------------------
+"""
+Usage: e_bench.py [options] <corpus>
+
+Run eprover with pinned search parameters and limits on a fixed
+benchmark corpus, collect performance data for each problem, and
+optionally compare the results against a stored baseline.
+
+The corpus file contains one problem per line (path relative to the
+corpus file's E root directory, i.e. the parent of etc/), optionally
+followed by additional prover options for this problem. Lines
+starting with "%options" give options used for all problems, empty
+lines and lines starting with "#" are ignored.
+
+For each problem, the following data is reported (timing values are
+medians over all repetitions):
+
+  status     SZS status of the run
+  processed  Number of processed clauses
+  time       Wall clock time of the complete prover run (s)
+  cps        Processed clauses per second in the saturation loop
+  rss        Peak resident set size (kB)
+  terms      Shared term nodes at the end of the saturation
+  dnodes     Nodes in the demodulator indices
+  fvstore    Storage of the feature vector subsumption index
+  itime      Time spent in index operations (s)
+  icalls     Number of index operations
+
+Options:
+
+-h
+--help
+  Print this help.
+
+-e <prover>
+--eprover=<prover>
+  Use the given prover binary. Default is PROVER/eprover.
+
+-r <n>
+--repeat=<n>
+  Run each problem n times. Default is 3.
+
+-o <file>
+--output=<file>
+  Write the results (as JSON) to the given file (e.g. to create a new
+  baseline).
+
+-b <file>
+--baseline=<file>
+  Compare the results against the baseline stored in file. The exit
+  status is 1 if any metric regressed by more than the tolerance.
+
+-t <percent>
+--tolerance=<percent>
+  Relative change of a timing or memory metric that is considered a
+  regression. Default is 10.
+
+Copyright 2026 agent, agent@local
+
+This code is part of the support structure for the equational
+theorem prover E. Visit
+
+ http://www.eprover.org
+
+for more information.
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program ; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+MA  02111-1307 USA
+"""
+
+import sys
+import os
+import getopt
+import json
+import shlex
+import statistics
+import subprocess
+import tempfile
+import time
+
+
+# Metrics where smaller is better and that depend on the machine,
+# and metrics where larger is better. Everything else is a property
+# of the search and is expected to be reproducible.
+lower_better  = ["time", "rss", "terms", "itime"]
+higher_better = ["cps"]
+# Timing differences below these values (in seconds) are noise.
+noise_floor   = {"time": 0.05, "itime": 0.05}
+columns = ["status", "processed", "time", "cps", "rss", "terms",
+           "dnodes", "fvstore", "itime", "icalls"]
+
+# Performance counters measuring index operations
+index_ctrs = ["PMIndexTimer", "BWRWIndexTimer", "IndexUnifTimer",
+              "IndexMatchTimer", "FVIndexTimer"]
+
+
+def parse_corpus(name):
+    """
+    Parse the corpus file and return a list of (problem, options)
+    pairs, with problem names relative to the E root directory.
+    """
+    common   = []
+    problems = []
+    with open(name, "r") as fp:
+        for line in fp:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            words = shlex.split(line)
+            if words[0] == "%options":
+                common.extend(words[1:])
+            else:
+                problems.append((words[0], words[1:]))
+    return [(prob, common+opts) for prob, opts in problems]
+
+
+def run_problem(prover, root, problem, options):
+    """
+    Run the prover once and return a dictionary of metrics.
+    """
+    with tempfile.TemporaryDirectory() as tmpdir:
+        progname = os.path.join(tmpdir, "progress")
+        perfname = os.path.join(tmpdir, "perf.json")
+        args = [prover, "--silent",
+                "--progress-stream="+progname,
+                "--progress-interval=1000000000",
+                "--perf-counters="+perfname]+options+\
+                [os.path.join(root, problem)]
+        env = dict(os.environ)
+        env["TPTP"] = os.path.join(root, "EXAMPLE_PROBLEMS", "TPTP")
+        start = time.time()
+        res = subprocess.run(args, stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT, env=env,
+                             universal_newlines=True)
+        runtime = time.time()-start
+
+        status = "Unknown"
+        for line in res.stdout.splitlines():
+            if line.startswith("# SZS status"):
+                status = line.split()[3]
+
+        final = {}
+        if os.path.exists(progname):
+            with open(progname, "r") as fp:
+                records = [json.loads(l) for l in fp if l.strip()]
+            if records:
+                final = records[-1]
+        perf = {"counters":{}}
+        if os.path.exists(perfname):
+            with open(perfname, "r") as fp:
+                perf = json.load(fp)
+
+    ctrs = perf["counters"]
+    sattime = final.get("time", 0.0)
+    processed = final.get("processed", 0)
+    return {
+        "status"   : status,
+        "processed": processed,
+        "time"     : runtime,
+        "cps"      : processed/sattime if sattime > 0 else 0.0,
+        "rss"      : final.get("max_rss", 0),
+        "terms"    : final.get("term_nodes", 0),
+        "dnodes"   : final.get("demod_index_nodes", 0),
+        "fvstore"  : final.get("fv_index_storage", 0),
+        "itime"    : sum(ctrs[c]["total"] for c in index_ctrs
+                         if c in ctrs)/1e9,
+        "icalls"   : sum(ctrs[c]["calls"] for c in index_ctrs
+                         if c in ctrs)
+        }
+
+
+def run_bench(prover, root, corpus, repeat):
+    """
+    Run all problems repeat times and return a dictionary mapping
+    problems to their (aggregated) metrics.
+    """
+    results = {}
+    for problem, options in corpus:
+        runs = [run_problem(prover, root, problem, options)
+                for i in range(repeat)]
+        res = dict(runs[0])
+        for key in lower_better+higher_better:
+            res[key] = statistics.median([r[key] for r in runs])
+        for key in columns:
+            if key not in lower_better+higher_better and \
+               any(r[key] != res[key] for r in runs):
+                print("# Warning: %s: %s differs between runs"%
+                      (problem, key), file=sys.stderr)
+        results[problem] = res
+        print_row(problem, res)
+        sys.stdout.flush()
+    return results
+
+
+def format_value(value):
+    if isinstance(value, float):
+        return "%.3f"%(value,) if value < 1000 else "%.0f"%(value,)
+    return str(value)
+
+
+def print_header():
+    print("%-40s"%("# Problem",)+"".join(["%14s"%(c,) for c in columns]))
+
+
+def print_row(problem, res):
+    print("%-40s"%(problem,)+
+          "".join(["%14s"%(format_value(res[c]),) for c in columns]))
+
+
+def compare(results, baseline, tolerance):
+    """
+    Compare results against baseline and print all differences.
+    Return the number of regressions.
+    """
+    regressions = 0
+    print("\n# Comparison against baseline (tolerance %.1f%%)"%(tolerance,))
+    for problem, res in results.items():
+        if problem not in baseline:
+            print("%-40s not in baseline"%(problem,))
+            continue
+        base = baseline[problem]
+        for key in columns:
+            old, new = base.get(key), res[key]
+            if old == new:
+                continue
+            if key in lower_better+higher_better:
+                if not old or \
+                   max(old, new) < noise_floor.get(key, 0):
+                    continue
+                change = 100.0*(new-old)/old
+                worse = change > tolerance if key in lower_better \
+                        else change < -tolerance
+                if abs(change) > tolerance:
+                    print("%-40s %-10s %12s -> %12s (%+.1f%%)%s"%
+                          (problem, key, format_value(old),
+                           format_value(new), change,
+                           " REGRESSION" if worse else ""))
+                    if worse:
+                        regressions += 1
+            else:
+                print("%-40s %-10s %12s -> %12s (search changed)"%
+                      (problem, key, format_value(old), format_value(new)))
+    for problem in baseline:
+        if problem not in results:
+            print("%-40s missing from results"%(problem,))
+    print("# %d regression(s)"%(regressions,))
+    return regressions
+
+
+def main(argv):
+    root      = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    prover    = os.path.join(root, "PROVER", "eprover")
+    repeat    = 3
+    output    = None
+    baseline  = None
+    tolerance = 10.0
+
+    try:
+        opts, args = getopt.gnu_getopt(argv, "he:r:o:b:t:",
+                                       ["help", "eprover=", "repeat=",
+                                        "output=", "baseline=",
+                                        "tolerance="])
+    except getopt.GetoptError as err:
+        print(err, file=sys.stderr)
+        sys.exit(2)
+
+    for option, optarg in opts:
+        if option in ("-h", "--help"):
+            print(__doc__)
+            sys.exit()
+        elif option in ("-e", "--eprover"):
+            prover = os.path.abspath(optarg)
+        elif option in ("-r", "--repeat"):
+            repeat = int(optarg)
+        elif option in ("-o", "--output"):
+            output = optarg
+        elif option in ("-b", "--baseline"):
+            baseline = optarg
+        elif option in ("-t", "--tolerance"):
+            tolerance = float(optarg)
+
+    if len(args) != 1:
+        print(__doc__)
+        sys.exit(2)
+
+    corpus = parse_corpus(args[0])
+    print("# Prover: %s, %d repetition(s)"%(prover, repeat))
+    print_header()
+    results = run_bench(prover, root, corpus, repeat)
+
+    if output:
+        with open(output, "w") as fp:
+            json.dump(results, fp, indent=2, sort_keys=True)
+            fp.write("\n")
+
+    if baseline:
+        if not os.path.exists(baseline):
+            print("# No baseline %s (create one with -o)"%(baseline,))
+        else:
+            with open(baseline, "r") as fp:
+                base = json.load(fp)
+            if compare(results, base, tolerance):
+                sys.exit(1)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -390,6 +390,94 @@ def parse_ordering_info(line):
     return res
 
 
+def invert_names(names):
+    """
+    Map C enum names back to the first command line name using
+    them.
+    """
+    res = {}
+    for i in sorted(names.keys()):
+        res.setdefault(names[i].strip(), i)
+    return res
+
+match_c_setting = re.compile("(?:control->heuristic_parms|oparms)\.([a-z_0-9]+) *= *([^;]*);")
+
+def table_settings(code):
+    """
+    Translate the assignments generated by parse_control_info() or
+    parse_ordering_info() into <parameter>=<value> settings of an
+    auto-mode table (see HEURISTICS/che_autotables.h). Values use the
+    command line names of eprover.
+    """
+    trans = {
+        "selection_strategy"  : invert_names(selstrat),
+        "ac_handling"         : invert_names(ac_handling),
+        "sat_check_grounding" : invert_names(sat_trans),
+        "to_weight_gen"       : invert_names(weight_gen),
+        "to_prec_gen"         : invert_names(prec_gen)
+        }
+    res = []
+    for m in match_c_setting.finditer(code):
+        parm, val = m.group(1), m.group(2).strip()
+        if parm in trans:
+            val = trans[parm][val]
+        elif parm == "pm_type":
+            val = val[len("Paramod"):]
+        res.append(parm+"="+val)
+    return res
+
+def table_setting_lines(head, settings):
+    """
+    Return the C string literals for head(<settings>), broken into
+    lines of reasonable length.
+    """
+    res  = []
+    line = "   "+head+"("
+    pad  = " "*len(line)
+    for i in xrange(len(settings)):
+        item = settings[i]
+        if i < len(settings)-1:
+            item = item+","
+        else:
+            item = item+")"
+        if i > 0:
+            if len(line)+len(item) >= 72:
+                res.append('"'+line+'\\n"')
+                line = pad
+            else:
+                line = line+" "
+        line = line+item
+    if not settings:
+        line = line+")"
+    res.append('"'+line+'\\n"')
+    return "\n".join(res)
+
+def table_case(name, desc, classes):
+    """
+    Return a case of an auto-mode table as C string literals. classes
+    is a list of pairs of class names (CLASS_<class>) and comments,
+    an empty list makes it the default case.
+    """
+    if classes:
+        res = '"case('+name+')\\n"\n'
+    else:
+        res = '"default('+name+')\\n"\n'
+    res = res+table_setting_lines("heuristic",
+                                  table_settings(parse_control_info(desc)))+"\n"
+    res = res+table_setting_lines("ordering",
+                                  table_settings(parse_ordering_info(desc)))+"\n"
+    if classes:
+        res = res+'"   classes(\\n"\n'
+        for i in xrange(len(classes)):
+            cl, comment = classes[i]
+            if i < len(classes)-1:
+                sep = ","
+            else:
+                sep = ")\\n"
+            res = res+'"      \''+cl[6:]+"\'"+sep+'" /* '+comment+" */\n"
+    return res
+
+
 #------------------------------------------------------------------
 # Begin data section
 #------------------------------------------------------------------
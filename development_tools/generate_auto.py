@@ -119,24 +119,9 @@ def compare_strat_global(strat1, strat2):
     return 0
 
 
-def translate_class(cl):
-    solved = repr(matrix[cl][result[cl]][0])
-    res = "      ( /* "+cl+" Solved: "+solved+ " of " +repr(classsize[cl]) + " */\n"
-    pref = "       ";
-    for i in xrange(6,len(cl)):
-        if cl[i]!="-":
-            res = res+pref+"Spec"+class_int[i][cl[i]]+"(spec)"
-            pref = "&&\n       "
-    res = res+")"
-    return res;
-
-def translate_class_list(cl):
-    res = "";
-    pref = "";
-    for i in cl:
-        res = res+pref+translate_class(i)+"\n"
-        pref = "       ||\n"
-    return res[0:-1];
+def table_classes(cl):
+    return [(i, repr(matrix[i][result[i]][0])+" of "+repr(classsize[i]))
+            for i in cl]
 
 def trans_heuristic_name(name):
     tmp = re.sub('p[^_]*_', "", name);
@@ -607,38 +592,14 @@ else:
 
     print """#endif
 
-#if defined(CHE_HEURISTICS_INTERNAL) || defined(TO_ORDERING_INTERNAL)
+#ifdef CHE_AUTOTABLES_INTERNAL
 """
 
     for i in by_heuristic.keys():
-        print "   else if("
-        print translate_class_list(by_heuristic[i])+")"
-        print '''   {
-#ifdef CHE_HEURISTICS_INTERNAL
-      res = "''' + trans_heuristic_name(i) +'";'
-
-        print parse_control_info(stratdesc[i])
-
-        print '''#endif
-#ifdef TO_ORDERING_INTERNAL'''
-
-        print parse_ordering_info(stratdesc[i])
-        print "#endif\n   }"
-
-
-
-    print "   else /* Default */"
-    print '''   {
-#ifdef CHE_HEURISTICS_INTERNAL
-  res = "''' + trans_heuristic_name(used[0]) +'";'
-
-    print parse_control_info(stratdesc[used[0]])
-
-    print '''#endif
-#ifdef TO_ORDERING_INTERNAL'''
-    print parse_ordering_info(stratdesc[used[0]])
-    print "#endif\n   }"
+        print table_case(trans_heuristic_name(i), stratdesc[i],
+                         table_classes(by_heuristic[i]))
 
+    print table_case(trans_heuristic_name(used[0]), stratdesc[used[0]], [])
 
     print "#endif"
 
@@ -288,24 +288,8 @@ def compare_strat_global(strat1, strat2):
     return 0
 
 
-def translate_class(cl, opt_res):
-    solved = repr(opt_res[cl])
-    res = "      ( /* "+cl+" Solved: "+solved+ " of " +repr(classsize[cl]) + " */\n"
-    pref = "       ";
-    for i in xrange(6,len(cl)):
-        if cl[i]!="-":
-            res = res+pref+"Spec"+class_int[i][cl[i]]+"(spec)"
-            pref = "&&\n       "
-    res = res+")"
-    return res;
-
-def translate_class_list(cl, opt_res):
-    res = "";
-    pref = "";
-    for i in cl:
-        res = res+pref+translate_class(i, opt_res)+"\n"
-        pref = "       ||\n"
-    return res[0:-1];
+def table_classes(cl, opt_res):
+    return [(i, repr(opt_res[i])+" of "+repr(classsize[i])) for i in cl]
 
 def trans_heuristic_name(name):
     tmp = re.sub('p[^_]*_', "", name);
@@ -412,42 +396,18 @@ def generate_output(fp, result, stratdesc, class_dir, raw_class, opt_res,
 
         fp.write( """#endif
 
-#if defined(CHE_HEURISTICS_INTERNAL) || defined(TO_ORDERING_INTERNAL)
+#ifdef CHE_AUTOTABLES_INTERNAL
 
 """)
 
         for i in by_heuristic.keys():
-            fp.write( "   else if(\n")
-            fp.write( translate_class_list(by_heuristic[i], opt_res)+")\n")
-            fp.write( '''   {
-#ifdef CHE_HEURISTICS_INTERNAL
-            res = "''' + trans_heuristic_name(i) +'";\n')
-
-            fp.write( parse_control_info(stratdesc[i])+"\n")
-
-            fp.write( '''#endif
-#ifdef TO_ORDERING_INTERNAL
-''')
-
-            fp.write( parse_ordering_info(stratdesc[i])+"\n")
-            fp.write( "#endif\n   }\n")
-
-
-
-        fp.write( "   else /* Default */\n")
-        fp.write( '''   {
-#ifdef CHE_HEURISTICS_INTERNAL
-  res = "''' + trans_heuristic_name(global_best) +'";\n')
-
-        fp.write( parse_control_info(stratdesc[global_best])+"\n")
+            fp.write(table_case(trans_heuristic_name(i), stratdesc[i],
+                                table_classes(by_heuristic[i], opt_res)))
 
-        fp.write( '''#endif
-#ifdef TO_ORDERING_INTERNAL
-''')
-        fp.write( parse_ordering_info(stratdesc[global_best])+"\n")
-        fp.write( "#endif\n   }\n")
+        fp.write(table_case(trans_heuristic_name(global_best),
+                            stratdesc[global_best], []))
 
-        fp.write( "#endif\n")
+        fp.write( "\n#endif\n")
 
         fp.write( "\n/* Total solutions on test set: %d */\n"%(sum(opt_res.values()),))
         fp.write("""/* -------------------------------------------------------*/